@@ -132,6 +132,19 @@
 //#define SERIAL_PORT_3 2
 //#define BAUDRATE_3 115200  // Enable to override BAUDRATE
 
+/**
+ * Route each kind of output only to the ports that subscribe to it, so host
+ * traffic isn't slowed down by (or mirrored onto) a slow display port.
+ * Each value is a mask of ports: 1 = SERIAL_PORT, 2 = SERIAL_PORT_2, 4 = SERIAL_PORT_3.
+ * Replies to a command go to the port that sent it, if that port takes HOST output.
+ */
+#define SERIAL_OUTPUT_CHANNELS
+#if ENABLED(SERIAL_OUTPUT_CHANNELS)
+  #define SERIAL_HOST_PORTS  1  // 'ok', 'echo:', reports and host actions
+  #define SERIAL_PANEL_PORTS 2  // Display frames
+  #define SERIAL_DEBUG_PORTS 1  // Debugging output
+#endif
+
 // Enable the Bluetooth serial interface on AT90USB devices
 //#define BLUETOOTH
 
@@ -1541,6 +1554,23 @@
 //#define MULTIPLE_PROBING 2
 //#define EXTRA_PROBING    1
 
+/**
+ * Predicted Probing
+ *
+ * When G29 can predict the bed height at a point (from the stored mesh or the
+ * points already probed) a single fast touch is accepted if it lands within
+ * PROBE_PREDICTED_TOLERANCE of the prediction. The first predicted point is
+ * probed both fast and as configured above, to find how far the fast touch
+ * lands from a normal reading, and later fast touches are corrected by that.
+ * A miss is probed as configured above. Moves between predicted points travel
+ * only PROBE_PREDICTED_CLEARANCE above the measured or predicted bed.
+ */
+//#define PROBE_FAST_PREDICTED
+#if ENABLED(PROBE_FAST_PREDICTED)
+  #define PROBE_PREDICTED_TOLERANCE 0.05 // (mm) Largest miss to accept the fast touch
+  #define PROBE_PREDICTED_CLEARANCE 2    // (mm) Travel height above the bed between points
+#endif
+
 /**
  * Z probes require clearance when deploying, stowing, and moving between
  * probe points to avoid hitting the bed and other hardware.
@@ -1930,6 +1960,15 @@
   #define SEGMENT_LEVELED_MOVES
   #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
 
+  /**
+   * With Bilinear leveling, split moves only where they cross grid lines
+   * (instead of every LEVELED_SEGMENT_LENGTH) and split a cell's piece further
+   * only when the bed's twist would pull it more than LEVELED_CELL_TOLERANCE
+   * away from the leveled surface.
+   */
+  #define SEGMENT_LEVELED_CELLS
+  #define LEVELED_CELL_TOLERANCE 0.01 // (mm) Most height error allowed within a cell
+
   /**
    * Enable the G26 Mesh Validation Pattern tool.
    */
@@ -1971,6 +2010,26 @@
       #define BILINEAR_SUBDIVISIONS 3
     #endif
 
+    //
+    // 'G29 A' probes every other grid line first and then probes the points in
+    // between only for cells where the bed curves more than the tolerance.
+    // Other points are interpolated, so a bump that lies only on a skipped
+    // line can be missed. Plain G29 always probes the full grid.
+    //
+    //#define ADAPTIVE_G29
+    #if ENABLED(ADAPTIVE_G29)
+      #define ADAPTIVE_G29_TOLERANCE 0.02 // (mm) Most interpolation error allowed
+    #endif
+
+    //
+    // Precompute the interpolation terms of every grid cell when the mesh
+    // changes, so each leveled segment only looks up its cell.
+    //
+    //#define ABL_CELL_COEFFICIENTS
+    #if ENABLED(ABL_CELL_COEFFICIENTS)
+      //#define ABL_CELL_FIXED_POINT  // Keep the terms in fixed point, for MCUs without an FPU
+    #endif
+
   #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
@@ -2172,13 +2231,31 @@
  *   M501 - Read settings from EEPROM. (i.e., Throw away unsaved changes)
  *   M502 - Revert settings to "factory" defaults. (Follow with M500 to init the EEPROM.)
  */
-//#define EEPROM_SETTINGS     // Persistent storage with M500 and M501
+#define EEPROM_SETTINGS       // Persistent storage with M500 and M501
 //#define DISABLE_M503        // Saves ~2700 bytes of flash. Disable for release!
 #define EEPROM_CHITCHAT       // Give feedback on EEPROM commands. Disable to save PROGMEM.
 #define EEPROM_BOOT_SILENT    // Keep M503 quiet and only give errors during first load
 #if ENABLED(EEPROM_SETTINGS)
-  //#define EEPROM_AUTO_INIT  // Init EEPROM automatically on any errors.
+  #define EEPROM_AUTO_INIT    // Init EEPROM automatically on any errors.
   //#define EEPROM_INIT_NOW   // Init EEPROM on first boot after a new build.
+
+  // Keep settings in two 128K sectors of MCU flash instead of the board's EEPROM.
+  // Each M500 appends only the changed parts to a log, which survives power loss during a save.
+  //#define FLASH_EEPROM_EMULATION
+  //#define FLASH_EEPROM_JOURNAL
+  #if ENABLED(FLASH_EEPROM_JOURNAL)
+    // MKS Eagle has 512K of flash, ending with sectors 6 and 7. Keep the firmware out of
+    // both with 'board_upload.maximum_size = 212992' (up to 0x08040000) in the env.
+    #define FLASH_SECTOR          7           // The log also uses the sector before this one
+    #define FLASH_ADDRESS_START   0x08060000
+  #endif
+
+  // Also keep PID, offsets, bilinear mesh and input shaping in tagged sections at the
+  // end of the EEPROM, so they survive a firmware update that resets the settings.
+  #define EEPROM_SECTIONS
+  #if ENABLED(EEPROM_SECTIONS)
+    #define EEPROM_SECTIONS_SIZE 512  // Bytes reserved at the end of the EEPROM
+  #endif
 #endif
 
 // @section host
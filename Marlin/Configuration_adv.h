@@ -372,6 +372,41 @@
    * Kill the machine on a stuck temperature sensor. Disable if you get false positives.
    */
   //#define THERMAL_PROTECTION_VARIANCE_MONITOR   // Detect a sensor malfunction preventing temperature updates
+
+  /**
+   * Model-based Thermal Protection
+   * Once calibrated, replace the PERIOD / HYSTERESIS windows above with a first-order
+   * model of each heater driven by the applied heater power, and halt the machine
+   * when the measured temperature departs from the prediction for THERMAL_MODEL_TRIP_TIME.
+   * The model slowly follows the sensor (THERMAL_MODEL_TRACKING) so small modeling
+   * errors and flow changes are absorbed, while a loose thermistor or a failed heater
+   * produces a fast, large residual.
+   *
+   * The model constants aren't entered by hand. With MPCTEMP they come from the hotend's
+   * MPC constants (M306). Otherwise each heater learns them from its first full-power
+   * heat-up followed by a minute held at the target, and reports them on the serial port.
+   * Until then the PERIOD / HYSTERESIS checks above protect the heater. Learned constants
+   * are kept until the next reset.
+   *
+   * The model stops following while the residual is over LIMIT, and while the heater is
+   * fully on or off it only follows a residual under half of LIMIT. A fault that puts the
+   * sensor more than LIMIT away from the model therefore trips after THERMAL_MODEL_TRIP_TIME.
+   * Below LIMIT a drift is only absorbed if it is slower than TRACKING * LIMIT. With the
+   * defaults that is 0.2°C/s for the hotend, 0.1°C/s for the bed and chamber and 0.05°C/s
+   * for the cooler, far below what a detached thermistor or a failed heater produces.
+   *
+   *  LIMIT: (°C) Largest residual allowed between the model and the sensor.
+   */
+  //#define THERMAL_PROTECTION_MODEL
+  #if ENABLED(THERMAL_PROTECTION_MODEL)
+    #define THERMAL_MODEL_AMBIENT          25   // (°C) Ambient temperature, if the chamber isn't measured
+    #define THERMAL_MODEL_TRACKING       0.01   // (1/s) How fast the model is pulled toward the sensor
+    #define THERMAL_MODEL_TRIP_TIME      1000   // (ms) Time the residual may stay over the limit
+    #define THERMAL_MODEL_HOTEND_LIMIT     20
+    #define THERMAL_MODEL_BED_LIMIT        10
+    #define THERMAL_MODEL_CHAMBER_LIMIT    10
+    #define THERMAL_MODEL_COOLER_LIMIT      5
+  #endif
 #endif
 
 #if ENABLED(PIDTEMP)
@@ -492,6 +527,54 @@
  */
 #define MILLISECONDS_PREHEAT_TIME 30000
 
+/**
+ * Predictive Heat-up
+ * Watch temperature commands (M104/M109, M140/M190, M141/M191) as they enter
+ * the command queue (and the start of a media print) and switch each heater
+ * on early, so that all heaters reach their targets at about the same time
+ * instead of heating one after another.
+ * The heating rates below are refined from measurements while heaters work.
+ */
+//#define PREDICTIVE_HEATUP
+#if ENABLED(PREDICTIVE_HEATUP)
+  #define PREDICTIVE_HEATUP_RATE_HOTEND   2.0   // (°C/s) Initial hotend heating rate (MPCTEMP uses the model)
+  #define PREDICTIVE_HEATUP_RATE_BED      0.5   // (°C/s) Initial bed heating rate
+  #define PREDICTIVE_HEATUP_RATE_CHAMBER  0.05  // (°C/s) Initial chamber heating rate
+  #define PREDICTIVE_HEATUP_MARGIN        10    // (s) Arm a heater this long before it is strictly needed
+  #define PREDICTIVE_HEATUP_MEDIA_SCAN    2048  // (bytes) Look-ahead at the start of a media print
+#endif
+
+/**
+ * Material Gate
+ * Check the chamber, material and bed temperatures against the windows below
+ * at a fixed rate. The display is sent 'ilksayfa.can.val' once each time the
+ * condition changes.
+ * Comment out a limit to leave that side of its window open.
+ */
+#define MATERIAL_GATE
+#if ENABLED(MATERIAL_GATE)
+  #define MATERIAL_GATE_INTERVAL       1000  // (ms) How often the windows are checked
+  #define MATERIAL_GATE_HYSTERESIS        1  // (°C) How far back inside a window a reading must be to count again
+
+  /**
+   * Also hold the command queue in front of a dispensing start (M5000, M6161,
+   * M6189, M6191) until all windows are satisfied. The machine keeps running
+   * while held. Send M108 to cancel. A hold that is cancelled or still waiting
+   * after MATERIAL_GATE_TIMEOUT aborts the job without dispensing.
+   */
+  //#define MATERIAL_GATE_HOLD
+  #if ENABLED(MATERIAL_GATE_HOLD)
+    #define MATERIAL_GATE_TIMEOUT       300  // (s) Abort the job after waiting this long
+  #endif
+
+  #define MATERIAL_GATE_CHAMBER_MIN      18  // (°C) Chamber window
+  //#define MATERIAL_GATE_CHAMBER_MAX    40
+  //#define MATERIAL_GATE_MATERIAL_MIN   20  // (°C) Material window, read from the hotend 0 sensor
+  //#define MATERIAL_GATE_MATERIAL_MAX   60
+  //#define MATERIAL_GATE_BED_MIN        15  // (°C) Bed window
+  //#define MATERIAL_GATE_BED_MAX        80
+#endif
+
 // @section extruder
 
 /**
@@ -620,6 +703,22 @@
   #endif
 #endif
 
+/**
+ * Heater Hardware PWM
+ *
+ * Drive heaters from hardware timer channels instead of toggling pins in the
+ * temperature ISR. Any heater whose pin has a timer channel (not shared with
+ * the step, temperature or pulse timers) is switched over at startup. Others
+ * keep using the software PWM.
+ *
+ * HEATER_PWM_FREQUENCY applies to the whole timer, so other outputs sharing
+ * a timer with a heater will also run at this frequency.
+ */
+//#define HEATER_HARDWARE_PWM   // (STM32 only)
+#if ENABLED(HEATER_HARDWARE_PWM)
+  #define HEATER_PWM_FREQUENCY 500  // (Hz)
+#endif
+
 /**
  * Use one of the PWM fans as a redundant part-cooling fan
  */
@@ -1539,6 +1638,42 @@
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
+  /**
+   * Read print files ahead in whole 512-byte blocks. Blocks are fetched while
+   * the command queue is full, so sector reads (slow on USB flash drives) are
+   * kept out of the path that refills the queue.
+   */
+  #define SD_READ_AHEAD
+  #if ENABLED(SD_READ_AHEAD)
+    #define SD_READ_AHEAD_BLOCKS 4          // Blocks held ahead of the print position (512 bytes RAM each)
+  #endif
+
+  /**
+   * Cache FAT blocks apart from file data, so following a file's cluster chain
+   * doesn't evict the data block being read. The least recently used FAT block
+   * is replaced. Each block uses 512 bytes of RAM. Set to 0 to share one buffer.
+   */
+  #define SD_FAT_CACHE_BLOCKS 4
+  #define SD_CLUSTER_RUNS                   // Step through contiguous clusters without reading the FAT
+
+  /**
+   * Keep a map of which parts of the FAT may hold free clusters, so new
+   * clusters for log files and uploads are found without reading the FAT
+   * blocks of a well-used drive one by one. The map is built in the background
+   * after mounting and kept current as clusters are allocated and freed.
+   */
+  #define SD_FREE_CLUSTER_MAP
+  #if ENABLED(SD_FREE_CLUSTER_MAP)
+    #define SD_FREE_CLUSTER_MAP_BYTES 64    // One bit per group of FAT blocks (Each FAT32 block covers 128 clusters)
+  #endif
+
+  /**
+   * Keep a pre-parsed copy of each file printed from the start, in a hidden
+   * .PGC file beside it. Later prints of the unchanged file (same size and
+   * date) load commands from it without parsing them. Uses about 700 bytes of RAM.
+   */
+  //#define SD_COMPILED_JOBS
+
   #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
   #define SD_FINISHED_RELEASECOMMAND "M84"  // Use "M84XYE" to keep Z enabled so your bed stays in place
 
@@ -1585,6 +1720,17 @@
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE 0.05 // (mm) Minimum Z change before saving power-loss data
 
+    // Keep the recovery data in a preallocated, contiguous PLR journal that is
+    // written block by block with no FAT or directory updates. Small records of
+    // the file position, position, feedrate, fans, temperatures and valves are
+    // appended, with a full checkpoint every POWER_LOSS_JOURNAL_CHECKPOINT records.
+    //#define POWER_LOSS_JOURNAL
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      #define POWER_LOSS_JOURNAL_BLOCKS      64 // Journal size in 512-byte blocks
+      #define POWER_LOSS_JOURNAL_CHECKPOINT  64 // Records between full checkpoints
+      #define POWER_LOSS_JOURNAL_INTERVAL  1000 // (ms) Also record this often while printing. 0 to record only on Z change.
+    #endif
+
     // Enable if Z homing is needed for proper recovery. 99.9% of the time this should be disabled!
     //#define POWER_LOSS_RECOVER_ZHOME
     #if ENABLED(POWER_LOSS_RECOVER_ZHOME)
@@ -1728,6 +1874,10 @@
   #if ENABLED(BINARY_FILE_TRANSFER)
     // Include extra facilities (e.g., 'M20 F') supporting firmware upload via BINARY_FILE_TRANSFER
     //#define CUSTOM_FIRMWARE_UPLOAD
+
+    // Accept compact fixed-point moves (protocol 2) in binary mode, bypassing the G-code parser.
+    // See buildroot/share/scripts/MarlinBinaryProtocol.py for the host side.
+    //#define BINARY_MOTION_STREAM
   #endif
 
   /**
@@ -2394,11 +2544,32 @@
   #define BLOCK_BUFFER_SIZE 16
 #endif
 
+/**
+ * Move Coalescing
+ *
+ * Merge runs of short, nearly collinear G1 moves that are already waiting in
+ * the command queue into longer planner moves, so the planner buffer covers
+ * more of the path. Any other command ends a run, so valve and dispense
+ * commands always act as barriers.
+ */
+//#define MOVE_COALESCING
+#if ENABLED(MOVE_COALESCING)
+  #define MOVE_COALESCE_TOLERANCE    0.01 // (mm) Max distance of merged points from the first move's line
+  #define MOVE_COALESCE_MAX_SEGMENT  2.0  // (mm) Only merge moves shorter than this
+  #define MOVE_COALESCE_MAX_LENGTH  10.0  // (mm) Longest merged move
+  #define MOVE_COALESCE_E_RATIO      0.02 // Max relative change in extrusion per mm between merged moves
+#endif
+
 // @section serial
 
 // The ASCII buffer for serial input
 #define MAX_CMD_SIZE 96
-#define BUFSIZE 4
+//#define BUFSIZE 4
+
+// Without BUFSIZE, fit as many commands as possible (up to 255) into this much RAM.
+// Each queued command costs MAX_CMD_SIZE + 12 bytes. Use with ADVANCED_OK so
+// the host can see how many slots are free.
+#define COMMAND_BUFFER_RAM 8192 // (bytes)
 
 // Transmission to Host Buffer Size
 // To save 386 bytes of flash (and TX_BUFFER_SIZE+3 bytes of RAM) set to 0.
@@ -2467,6 +2638,22 @@
   //#define FULL_REPORT_TO_HOST_FEATURE   // Auto-report the machine status like Grbl CNC
 #endif
 
+/**
+ * Emergency Overrides
+ * Act on some commands as soon as they arrive instead of after the queue.
+ * Requires EMERGENCY_PARSER.
+ *
+ * - M220 S<percent> and M221 S<percent> apply from the next planned move.
+ *   Moves already in the planner keep their speed and flow.
+ * - P000 holds motion and R000 resumes it, as with REALTIME_REPORTING_COMMANDS.
+ * - C000 shuts the dispensing valves and holds motion. Valve commands other
+ *   than M2828 are refused until R000 is received.
+ */
+#define EMERGENCY_OVERRIDES
+#if ENABLED(EMERGENCY_OVERRIDES)
+  #define EMERGENCY_VALVE_PINS { PC6, PD11, PD10, PE15, PE13, PE12, PE11, PE8, PA5, PA6 } // Driven LOW by C000
+#endif
+
 // Bad Serial-connections can miss a received command by sending an 'ok'
 // Therefore some clients abort after 30 seconds in a timeout.
 // Some other clients start sending commands while receiving a 'wait'.
@@ -2474,7 +2661,8 @@
 //#define NO_TIMEOUTS 1000 // Milliseconds
 
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
-//#define ADVANCED_OK
+// See buildroot/share/scripts/windowed_sender.py for a host that uses it.
+#define ADVANCED_OK
 
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
@@ -3009,6 +3197,16 @@
   //#define E6_SLAVE_ADDRESS 0
   //#define E7_SLAVE_ADDRESS 0
 
+  /**
+   * Talk to single-wire TMC2208/TMC2209 drivers with a timer and DMA instead
+   * of SoftwareSerial. Bits are clocked out and the reply is sampled without
+   * interrupting the CPU, so register reads (M122, driver monitoring) don't
+   * delay the stepper interrupt. Drivers sharing a wire are told apart by
+   * *_SLAVE_ADDRESS. Each *_SERIAL_RX_PIN must be the same as *_SERIAL_TX_PIN.
+   * STM32F4/F7 only. Uses TIM8 and DMA2 Stream 1.
+   */
+  //#define TMC_SERIAL_DMA
+
   // @section tmc/smart
 
   /**
@@ -278,4 +278,17 @@ public:
    */
   static void set_pwm_frequency(const pin_t pin, const uint16_t f_desired);
 
+  /**
+   * Check that the pin has a timer channel that isn't
+   * reserved for the stepper, temperature or pulse timers.
+   */
+  static bool pwm_timer_available(const pin_t pin);
+
+  /**
+   * Get the compare and auto-reload registers of the pin's timer channel,
+   * so an interrupt can change the duty without going through the library.
+   * Call after set_pwm_duty has set up the channel.
+   */
+  static void get_pwm_registers(const pin_t pin, volatile uint32_t* &ccr, volatile uint32_t* &arr);
+
 };
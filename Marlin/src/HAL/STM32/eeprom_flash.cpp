@@ -49,7 +49,7 @@
  * on 2 of these pages. Each write, we'd use 2 different pages from a pool of pages until we are done.
  */
 
-#if ENABLED(FLASH_EEPROM_LEVELING)
+#if EITHER(FLASH_EEPROM_LEVELING, FLASH_EEPROM_JOURNAL)
 
   #include "stm32_def.h"
 
@@ -72,9 +72,6 @@
   #endif
   #define FLASH_ADDRESS_END       (FLASH_ADDRESS_START + FLASH_UNIT_SIZE  - 1)
 
-  #define EEPROM_SLOTS            ((FLASH_UNIT_SIZE) / (MARLIN_EEPROM_SIZE))
-  #define SLOT_ADDRESS(slot)      (FLASH_ADDRESS_START + (slot * (MARLIN_EEPROM_SIZE)))
-
   #define UNLOCK_FLASH()          if (!flash_unlocked) { \
                                     HAL_FLASH_Unlock(); \
                                     __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | \
@@ -87,15 +84,210 @@
   #define EMPTY_UINT8             ((uint8_t)-1)
 
   static uint8_t ram_eeprom[MARLIN_EEPROM_SIZE] __attribute__((aligned(4))) = {0};
-  static int current_slot = -1;
 
   static_assert(0 == MARLIN_EEPROM_SIZE % 4, "MARLIN_EEPROM_SIZE must be a multiple of 4"); // Ensure copying as uint32_t is safe
-  static_assert(0 == FLASH_UNIT_SIZE % MARLIN_EEPROM_SIZE, "MARLIN_EEPROM_SIZE must divide evenly into your FLASH_UNIT_SIZE");
-  static_assert(FLASH_UNIT_SIZE >= MARLIN_EEPROM_SIZE, "FLASH_UNIT_SIZE must be greater than or equal to your MARLIN_EEPROM_SIZE");
   static_assert(IS_FLASH_SECTOR(FLASH_SECTOR), "FLASH_SECTOR is invalid");
   static_assert(IS_POWER_OF_2(FLASH_UNIT_SIZE), "FLASH_UNIT_SIZE should be a power of 2, please check your chip's spec sheet");
 
-#endif // FLASH_EEPROM_LEVELING
+  // Erase one flash sector. Most STM32F4 flash can't be read during the erase.
+  static HAL_StatusTypeDef erase_sector(const uint32_t sector) {
+    FLASH_EraseInitTypeDef EraseInitStruct;
+    uint32_t SectorError = 0;
+
+    EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
+    EraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
+    EraseInitStruct.Sector = sector;
+    EraseInitStruct.NbSectors = 1;
+
+    TERN_(HAS_PAUSE_SERVO_OUTPUT, PAUSE_SERVO_OUTPUT());
+    hal.isr_off();
+    const HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
+    hal.isr_on();
+    TERN_(HAS_PAUSE_SERVO_OUTPUT, RESUME_SERVO_OUTPUT());
+    if (status != HAL_OK) {
+      DEBUG_ECHOLNPGM("HAL_FLASHEx_Erase=", status);
+      DEBUG_ECHOLNPGM("GetError=", HAL_FLASH_GetError());
+      DEBUG_ECHOLNPGM("SectorError=", SectorError);
+    }
+    return status;
+  }
+
+#endif
+
+#if ENABLED(FLASH_EEPROM_LEVELING)
+
+  #define EEPROM_SLOTS            ((FLASH_UNIT_SIZE) / (MARLIN_EEPROM_SIZE))
+  #define SLOT_ADDRESS(slot)      (FLASH_ADDRESS_START + (slot * (MARLIN_EEPROM_SIZE)))
+
+  static int current_slot = -1;
+
+  static_assert(0 == FLASH_UNIT_SIZE % MARLIN_EEPROM_SIZE, "MARLIN_EEPROM_SIZE must divide evenly into your FLASH_UNIT_SIZE");
+  static_assert(FLASH_UNIT_SIZE >= MARLIN_EEPROM_SIZE, "FLASH_UNIT_SIZE must be greater than or equal to your MARLIN_EEPROM_SIZE");
+
+#elif ENABLED(FLASH_EEPROM_JOURNAL)
+
+  /**
+   * Journalled storage
+   *
+   * Two flash sectors (FLASH_SECTOR and the one before it) take turns holding a
+   * log. A log starts with a record of every chunk of the EEPROM, followed by a
+   * record for each later save holding only the chunks it changed.
+   *
+   * A record is a header word, the changed chunks (index word + data) and a commit
+   * word carrying their CRC. The commit word is written last, so a save cut short
+   * by a reset or power loss fails its check and is skipped on load.
+   *
+   * When the log is full the whole EEPROM is written as the first record of the
+   * other sector, and the header of that sector is written last. Until then the
+   * old log remains the valid one.
+   */
+  #define JOURNAL_CHUNK           32                                  // Bytes of EEPROM per chunk
+  #define JOURNAL_CHUNKS          ((MARLIN_EEPROM_SIZE) / (JOURNAL_CHUNK))
+  #define JOURNAL_MAGIC           0x314C4A4DUL                        // "MJL1" Log header
+  #define JOURNAL_RECORD          0xEC000000UL                        // Record header + chunk count
+  #define JOURNAL_COMMIT          0xC0000000UL                        // Commit word + CRC16
+  #define JOURNAL_LOG_ADDRESS(n)  (FLASH_ADDRESS_START - ((1 - (n)) * (FLASH_UNIT_SIZE)))
+  #define JOURNAL_LOG_SECTOR(n)   ((FLASH_SECTOR) - 1 + (n))
+  #define JOURNAL_HEADER_SIZE     (2 * sizeof(uint32_t))              // Magic + sequence
+  #define JOURNAL_ENTRY_SIZE      (sizeof(uint32_t) + (JOURNAL_CHUNK))
+  #define JOURNAL_RECORD_SIZE(n)  (2 * sizeof(uint32_t) + (n) * (JOURNAL_ENTRY_SIZE))
+
+  static_assert(0 == MARLIN_EEPROM_SIZE % (JOURNAL_CHUNK), "MARLIN_EEPROM_SIZE must be a multiple of JOURNAL_CHUNK");
+  static_assert(JOURNAL_HEADER_SIZE + JOURNAL_RECORD_SIZE(JOURNAL_CHUNKS) <= FLASH_UNIT_SIZE, "MARLIN_EEPROM_SIZE is too large for FLASH_EEPROM_JOURNAL");
+  static_assert(IS_FLASH_SECTOR((FLASH_SECTOR) - 1), "FLASH_EEPROM_JOURNAL needs the sector before FLASH_SECTOR");
+  #ifdef STM32_FLASH_SIZE
+    // The framework assumes the largest part of the line, so check against the real size
+    static_assert(FLASH_ADDRESS_END < FLASH_BASE + (STM32_FLASH_SIZE) * 1024UL, "FLASH_EEPROM_JOURNAL is past the end of flash. Set FLASH_SECTOR and FLASH_ADDRESS_START for STM32_FLASH_SIZE.");
+  #endif
+
+  static int8_t log_index = -1;                 // Sector of the current log (0 or 1)
+  static uint32_t log_sequence,                 // Increases with each new log
+                  log_write_address;            // Where the next record goes
+  static uint32_t dirty_chunks[(JOURNAL_CHUNKS + 31) / 32];
+
+  #define FLASH_WORD(A)           (*(__IO uint32_t*)(A))
+
+  static void set_dirty(const int pos) { SBI32(dirty_chunks[pos / (JOURNAL_CHUNK) / 32], (pos / (JOURNAL_CHUNK)) % 32); }
+  static bool is_dirty(const uint16_t chunk) { return TEST32(dirty_chunks[chunk / 32], chunk % 32); }
+
+  // Apply the chunks of a record, if it was committed and its CRC checks out
+  static bool replay_record(const uint32_t address, const uint16_t count) {
+    uint16_t crc = 0;
+    uint32_t a = address + sizeof(uint32_t);
+    for (uint16_t i = 0; i < count; i++, a += JOURNAL_ENTRY_SIZE) {
+      const uint32_t chunk = FLASH_WORD(a);
+      if (chunk >= JOURNAL_CHUNKS) return false;
+      crc16(&crc, (const void*)a, JOURNAL_ENTRY_SIZE);
+    }
+    if (FLASH_WORD(a) != (JOURNAL_COMMIT | crc)) return false;
+    a = address + sizeof(uint32_t);
+    for (uint16_t i = 0; i < count; i++, a += JOURNAL_ENTRY_SIZE)
+      memcpy(&ram_eeprom[FLASH_WORD(a) * (JOURNAL_CHUNK)], (const void*)(a + sizeof(uint32_t)), JOURNAL_CHUNK);
+    return true;
+  }
+
+  // Find the newest log and replay its records into RAM
+  static void journal_load() {
+    memset(ram_eeprom, EMPTY_UINT8, sizeof(ram_eeprom));
+    ZERO(dirty_chunks);
+    log_index = -1;
+
+    LOOP_L_N(n, 2) {
+      const uint32_t base = JOURNAL_LOG_ADDRESS(n);
+      if (FLASH_WORD(base) == JOURNAL_MAGIC && (log_index < 0 || FLASH_WORD(base + 4) > log_sequence)) {
+        log_index = n;
+        log_sequence = FLASH_WORD(base + 4);
+      }
+    }
+    if (log_index < 0) return;
+
+    const uint32_t base = JOURNAL_LOG_ADDRESS(log_index), end = base + FLASH_UNIT_SIZE;
+    uint32_t address = base + JOURNAL_HEADER_SIZE;
+    uint16_t records = 0;
+    while (address + JOURNAL_RECORD_SIZE(0) <= end) {
+      const uint32_t header = FLASH_WORD(address);
+      if (header == EMPTY_UINT32) break;                       // End of the log
+      const uint16_t count = header & 0xFFFF;
+      if ((header & 0xFFFF0000UL) != JOURNAL_RECORD || count > JOURNAL_CHUNKS || address + JOURNAL_RECORD_SIZE(count) > end) {
+        address = end;                                         // Damaged. Start a new log on the next save.
+        break;
+      }
+      if (replay_record(address, count)) records++;
+      address += JOURNAL_RECORD_SIZE(count);
+    }
+    log_write_address = address;
+    DEBUG_ECHOLNPGM("EEPROM loaded from log ", int(log_index), ", ", records, " records.");
+  }
+
+  static bool program_word(uint32_t &address, const uint32_t data) {
+    const HAL_StatusTypeDef status = HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, address, data);
+    if (status != HAL_OK) {
+      DEBUG_ECHOLNPGM("HAL_FLASH_Program=", status);
+      DEBUG_ECHOLNPGM("GetError=", HAL_FLASH_GetError());
+      DEBUG_ECHOLNPGM("address=", address);
+      return false;
+    }
+    address += sizeof(uint32_t);
+    return true;
+  }
+
+  // Write a record holding the dirty chunks, or all chunks
+  static bool write_record(uint32_t address, const bool all, const uint16_t count) {
+    uint16_t crc = 0;
+    if (!program_word(address, JOURNAL_RECORD | count)) return false;
+    for (uint16_t chunk = 0; chunk < JOURNAL_CHUNKS; chunk++) {
+      if (!all && !is_dirty(chunk)) continue;
+      const uint32_t start = address;
+      if (!program_word(address, chunk)) return false;
+      const uint8_t *data = &ram_eeprom[chunk * (JOURNAL_CHUNK)];
+      for (uint8_t i = 0; i < JOURNAL_CHUNK; i += sizeof(uint32_t)) {
+        uint32_t word;
+        memcpy(&word, data + i, sizeof(word));
+        if (!program_word(address, word)) return false;
+      }
+      crc16(&crc, (const void*)start, JOURNAL_ENTRY_SIZE);
+    }
+    return program_word(address, JOURNAL_COMMIT | crc);
+  }
+
+  // Start a new log in the other sector, holding the whole EEPROM
+  static bool journal_restart() {
+    const int8_t next = log_index < 0 ? 0 : 1 - log_index;
+    const uint32_t base = JOURNAL_LOG_ADDRESS(next);
+    if (erase_sector(JOURNAL_LOG_SECTOR(next)) != HAL_OK) return false;
+    uint32_t address = base + sizeof(uint32_t);
+    if (!write_record(base + JOURNAL_HEADER_SIZE, true, JOURNAL_CHUNKS)) return false;
+    if (!program_word(address, log_sequence + 1)) return false;
+    address = base;
+    if (!program_word(address, JOURNAL_MAGIC)) return false;
+    log_index = next;
+    log_sequence++;
+    log_write_address = base + JOURNAL_HEADER_SIZE + JOURNAL_RECORD_SIZE(JOURNAL_CHUNKS);
+    DEBUG_ECHOLNPGM("EEPROM log ", int(log_index), " started.");
+    return true;
+  }
+
+  // Append the changed chunks to the log, or start a new log if there's no room
+  static bool journal_save() {
+    uint16_t count = 0;
+    for (uint16_t chunk = 0; chunk < JOURNAL_CHUNKS; chunk++) if (is_dirty(chunk)) count++;
+    bool success = true;
+    if (count) {
+      const uint32_t end = JOURNAL_LOG_ADDRESS(log_index < 0 ? 0 : log_index) + FLASH_UNIT_SIZE;
+      if (log_index < 0 || log_write_address + JOURNAL_RECORD_SIZE(count) > end)
+        success = journal_restart();
+      else {
+        const uint32_t address = log_write_address;
+        log_write_address += JOURNAL_RECORD_SIZE(count);       // Skip a failed record, as load does
+        success = write_record(address, false, count) || journal_restart();
+        if (success) DEBUG_ECHOLNPGM("EEPROM saved ", count, " chunks to log ", int(log_index), ".");
+      }
+    }
+    if (success) ZERO(dirty_chunks);
+    return success;
+  }
+
+#endif // FLASH_EEPROM_JOURNAL
 
 static bool eeprom_data_written = false;
 
@@ -108,7 +300,16 @@ bool PersistentStore::access_start() {
 
   EEPROM.begin(); // Avoid STM32 EEPROM.h warning (do nothing)
 
-  #if ENABLED(FLASH_EEPROM_LEVELING)
+  #if ENABLED(FLASH_EEPROM_JOURNAL)
+
+    if (log_index < 0 || eeprom_data_written) {
+      // First access since power on, or a write_data that never called access_finish
+      if (eeprom_data_written) DEBUG_ECHOLNPGM("Dangling EEPROM write_data");
+      journal_load();
+      eeprom_data_written = false;
+    }
+
+  #elif ENABLED(FLASH_EEPROM_LEVELING)
 
     if (current_slot == -1 || eeprom_data_written) {
       // This must be the first time since power on that we have accessed the storage, or someone
@@ -154,34 +355,25 @@ bool PersistentStore::access_finish() {
       __HAL_FLASH_CLEAR_FLAG(FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR);
     #endif
 
-    #if ENABLED(FLASH_EEPROM_LEVELING)
+    #if ENABLED(FLASH_EEPROM_JOURNAL)
+
+      bool flash_unlocked = false;
+      UNLOCK_FLASH();
+      const bool success = journal_save();
+      LOCK_FLASH();
+      if (success) eeprom_data_written = false;
+      return success;
+
+    #elif ENABLED(FLASH_EEPROM_LEVELING)
 
       HAL_StatusTypeDef status = HAL_ERROR;
       bool flash_unlocked = false;
 
       if (--current_slot < 0) {
         // all slots have been used, erase everything and start again
-
-        FLASH_EraseInitTypeDef EraseInitStruct;
-        uint32_t SectorError = 0;
-
-        EraseInitStruct.TypeErase = FLASH_TYPEERASE_SECTORS;
-        EraseInitStruct.VoltageRange = FLASH_VOLTAGE_RANGE_3;
-        EraseInitStruct.Sector = FLASH_SECTOR;
-        EraseInitStruct.NbSectors = 1;
-
         current_slot = EEPROM_SLOTS - 1;
         UNLOCK_FLASH();
-
-        TERN_(HAS_PAUSE_SERVO_OUTPUT, PAUSE_SERVO_OUTPUT());
-        hal.isr_off();
-        status = HAL_FLASHEx_Erase(&EraseInitStruct, &SectorError);
-        hal.isr_on();
-        TERN_(HAS_PAUSE_SERVO_OUTPUT, RESUME_SERVO_OUTPUT());
-        if (status != HAL_OK) {
-          DEBUG_ECHOLNPGM("HAL_FLASHEx_Erase=", status);
-          DEBUG_ECHOLNPGM("GetError=", HAL_FLASH_GetError());
-          DEBUG_ECHOLNPGM("SectorError=", SectorError);
+        if (erase_sector(FLASH_SECTOR) != HAL_OK) {
           LOCK_FLASH();
           return false;
         }
@@ -246,9 +438,10 @@ bool PersistentStore::access_finish() {
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
   while (size--) {
     uint8_t v = *value;
-    #if ENABLED(FLASH_EEPROM_LEVELING)
+    #if EITHER(FLASH_EEPROM_LEVELING, FLASH_EEPROM_JOURNAL)
       if (v != ram_eeprom[pos]) {
         ram_eeprom[pos] = v;
+        TERN_(FLASH_EEPROM_JOURNAL, set_dirty(pos));
         eeprom_data_written = true;
       }
     #else
@@ -266,7 +459,13 @@ bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, ui
 
 bool PersistentStore::read_data(int &pos, uint8_t *value, size_t size, uint16_t *crc, const bool writing/*=true*/) {
   do {
-    const uint8_t c = TERN(FLASH_EEPROM_LEVELING, ram_eeprom[pos], eeprom_buffered_read_byte(pos));
+    const uint8_t c = (
+      #if EITHER(FLASH_EEPROM_LEVELING, FLASH_EEPROM_JOURNAL)
+        ram_eeprom[pos]
+      #else
+        eeprom_buffered_read_byte(pos)
+      #endif
+    );
     if (writing) *value = c;
     crc16(crc, &c, 1);
     pos++;
@@ -29,6 +29,24 @@
 // Array to support sticky frequency sets per timer
 static uint16_t timer_freq[TIMER_NUM];
 
+// Timers that Marlin uses for its own interrupts
+static bool timer_is_reserved(const timer_index_t index) {
+  #ifdef STEP_TIMER
+    if (index == TIMER_INDEX(STEP_TIMER)) return true;
+  #endif
+  #ifdef TEMP_TIMER
+    if (index == TIMER_INDEX(TEMP_TIMER)) return true;
+  #endif
+  #if defined(PULSE_TIMER) && MF_TIMER_PULSE != MF_TIMER_STEP
+    if (index == TIMER_INDEX(PULSE_TIMER)) return true;
+  #endif
+  #ifdef TMC_SERIAL_TIMER
+    if (index == TIMER_INDEX(TMC_SERIAL_TIMER)) return true;
+  #endif
+  UNUSED(index);
+  return false;
+}
+
 void MarlinHAL::set_pwm_duty(const pin_t pin, const uint16_t v, const uint16_t v_size/*=255*/, const bool invert/*=false*/) {
   const uint16_t duty = invert ? v_size - v : v;
   if (PWM_PIN(pin)) {
@@ -67,16 +85,7 @@ void MarlinHAL::set_pwm_frequency(const pin_t pin, const uint16_t f_desired) {
   TIM_TypeDef * const Instance = (TIM_TypeDef *)pinmap_peripheral(pin_name, PinMap_PWM); // Get HAL timer instance
   const timer_index_t index = get_timer_index(Instance);
 
-  // Protect used timers.
-  #ifdef STEP_TIMER
-    if (index == TIMER_INDEX(STEP_TIMER)) return;
-  #endif
-  #ifdef TEMP_TIMER
-    if (index == TIMER_INDEX(TEMP_TIMER)) return;
-  #endif
-  #if defined(PULSE_TIMER) && MF_TIMER_PULSE != MF_TIMER_STEP
-    if (index == TIMER_INDEX(PULSE_TIMER)) return;
-  #endif
+  if (timer_is_reserved(index)) return; // Protect used timers.
 
   if (HardwareTimer_Handle[index] == nullptr) // If frequency is set before duty we need to create a handle here.
     HardwareTimer_Handle[index]->__this = new HardwareTimer((TIM_TypeDef *)pinmap_peripheral(pin_name, PinMap_PWM));
@@ -85,4 +94,18 @@ void MarlinHAL::set_pwm_frequency(const pin_t pin, const uint16_t f_desired) {
   timer_freq[index] = f_desired; // Save the last frequency so duty will not set the default for this timer number.
 }
 
+bool MarlinHAL::pwm_timer_available(const pin_t pin) {
+  if (!PWM_PIN(pin)) return false;
+  TIM_TypeDef * const Instance = (TIM_TypeDef *)pinmap_peripheral(digitalPinToPinName(pin), PinMap_PWM);
+  return !timer_is_reserved(get_timer_index(Instance));
+}
+
+void MarlinHAL::get_pwm_registers(const pin_t pin, volatile uint32_t* &ccr, volatile uint32_t* &arr) {
+  const PinName pin_name = digitalPinToPinName(pin);
+  TIM_TypeDef * const Instance = (TIM_TypeDef *)pinmap_peripheral(pin_name, PinMap_PWM);
+  const uint32_t channel = STM_PIN_CHANNEL(pinmap_function(pin_name, PinMap_PWM));
+  ccr = &Instance->CCR1 + (channel - 1); // CCR1-CCR4 are consecutive
+  arr = &Instance->ARR;
+}
+
 #endif // HAL_STM32
@@ -41,6 +41,20 @@
   #error "FLASH_EEPROM_LEVELING is currently only supported on STM32F4 hardware."
 #endif
 
+#if ENABLED(FLASH_EEPROM_JOURNAL)
+  #if !defined(STM32F4xx)
+    #error "FLASH_EEPROM_JOURNAL is currently only supported on STM32F4 hardware."
+  #elif DISABLED(FLASH_EEPROM_EMULATION)
+    #error "FLASH_EEPROM_JOURNAL requires FLASH_EEPROM_EMULATION."
+  #elif ENABLED(FLASH_EEPROM_LEVELING)
+    #error "FLASH_EEPROM_JOURNAL and FLASH_EEPROM_LEVELING are incompatible. Choose one."
+  #endif
+#endif
+
+#if ENABLED(TMC_SERIAL_DMA) && (NOT_TARGET(STM32F4xx, STM32F7xx) || !defined(TIM8_BASE))
+  #error "TMC_SERIAL_DMA is currently only supported on STM32F4/F7 hardware with TIM8."
+#endif
+
 #if ENABLED(SERIAL_STATS_MAX_RX_QUEUED)
   #error "SERIAL_STATS_MAX_RX_QUEUED is not supported on STM32."
 #elif ENABLED(SERIAL_STATS_DROPPED_RX)
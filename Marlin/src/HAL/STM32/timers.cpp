@@ -296,7 +296,7 @@ IF_ENABLED(HAS_TMC_SW_SERIAL, static constexpr uintptr_t timer_serial[] = {uintp
 IF_ENABLED(SPEAKER,           static constexpr uintptr_t timer_tone[]   = {uintptr_t(TIMER_TONE)});
 IF_ENABLED(HAS_SERVOS,        static constexpr uintptr_t timer_servo[]  = {uintptr_t(TIMER_SERVO)});
 
-enum TimerPurpose { TP_SERIAL, TP_TONE, TP_SERVO, TP_STEP, TP_TEMP };
+enum TimerPurpose { TP_SERIAL, TP_TONE, TP_SERVO, TP_STEP, TP_TEMP, TP_TMC_DMA };
 
 // List of timers, to enable checking for conflicts.
 // Includes the purpose of each timer to ease debugging when evaluating at build-time.
@@ -311,6 +311,9 @@ static constexpr struct { TimerPurpose p; int t; } timers_in_use[] = {
   #if HAS_SERVOS
     { TP_SERVO, get_timer_num_from_base_address(timer_servo[0]) },   // Set in variant.h, or as a define in platformio.h if not present in variant.h
   #endif
+  #ifdef TMC_SERIAL_TIMER
+    { TP_TMC_DMA, TMC_SERIAL_TIMER },
+  #endif
   { TP_STEP, STEP_TIMER },
   { TP_TEMP, TEMP_TIMER },
 };
@@ -48,6 +48,10 @@
 #define TIMER_INDEX_(T) TIMER##T##_INDEX  // TIMER#_INDEX enums (timer_index_t) depend on TIM#_BASE defines.
 #define TIMER_INDEX(T) TIMER_INDEX_(T)    // Convert Timer ID to HardwareTimer_Handle index.
 
+#if ENABLED(TMC_SERIAL_DMA)
+  #define TMC_SERIAL_TIMER 8  // TIM8 update requests are served by DMA2 Stream 1, Channel 7
+#endif
+
 #define TEMP_TIMER_FREQUENCY 1000   // Temperature::isr() is expected to be called at around 1kHz
 
 // TODO: get rid of manual rate/prescale/ticks/cycles taken for procedures in stepper.cpp
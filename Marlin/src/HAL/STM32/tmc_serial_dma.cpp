@@ -0,0 +1,187 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../platforms.h"
+
+#ifdef HAL_STM32
+
+#include "../../inc/MarlinConfig.h"
+
+#if HAS_TMC_DMA_SERIAL
+
+#include "tmc_serial_dma.h"
+
+#ifndef TMC_SERIAL_DMA_IRQ_PRIO
+  #define TMC_SERIAL_DMA_IRQ_PRIO 5 // A late interrupt only stretches the idle time between bytes
+#endif
+
+#define OVERSAMPLE   4    // Reply samples per bit
+#define TX_BYTES     8    // Longest datagram (register write)
+#define RX_BITS    120    // Reply delay plus an 8-byte reply, with room to spare
+
+#define TMC_DMA_TIMER    TIM8
+#define TMC_DMA_STREAM   DMA2_Stream1
+#define TMC_DMA_CHANNEL  (7UL << DMA_SxCR_CHSEL_Pos)
+#define TMC_DMA_IRQn     DMA2_Stream1_IRQn
+#define TMC_DMA_FLAGS    (DMA_LIFCR_CTCIF1 | DMA_LIFCR_CHTIF1 | DMA_LIFCR_CTEIF1 | DMA_LIFCR_CDMEIF1 | DMA_LIFCR_CFEIF1)
+
+enum BusState : uint8_t { BUS_IDLE, BUS_TX, BUS_RX };
+
+static TMCSerialDMA *owner = nullptr;       // Instance that wrote last, and gets the reply
+static volatile BusState bus_state = BUS_IDLE;
+static uint32_t tx_words[TX_BYTES * 10];    // One BSRR word per bit
+static volatile uint8_t tx_count, tx_sent;  // Words queued / words handed to DMA
+static uint8_t rx_samples[RX_BITS * OVERSAMPLE];
+static uint16_t bit_ticks;                  // Timer ticks per bit
+
+// Stop the timer and the stream, and drop the interrupt that disabling the stream raises
+static void bus_stop() {
+  TMC_DMA_TIMER->CR1 &= ~TIM_CR1_CEN;
+  TMC_DMA_STREAM->CR &= ~DMA_SxCR_EN;
+  while (TMC_DMA_STREAM->CR & DMA_SxCR_EN) { /* nada */ }
+  DMA2->LIFCR = TMC_DMA_FLAGS;
+  NVIC_ClearPendingIRQ(TMC_DMA_IRQn);
+}
+
+// Move one item per timer update, starting one whole period from now
+static void bus_start(const uint32_t cr, volatile void * const periph, void * const mem, const uint16_t count, const uint16_t ticks) {
+  bus_stop();
+  TMC_DMA_STREAM->CR = TMC_DMA_CHANNEL | DMA_SxCR_PL_1 | DMA_SxCR_MINC | DMA_SxCR_TCIE | cr;
+  TMC_DMA_STREAM->PAR = uint32_t(periph);
+  TMC_DMA_STREAM->M0AR = uint32_t(mem);
+  TMC_DMA_STREAM->NDTR = count;
+  TMC_DMA_TIMER->DIER = 0;              // Clear a request left over from the last transfer
+  TMC_DMA_TIMER->ARR = ticks - 1;
+  TMC_DMA_TIMER->CNT = 0;
+  TMC_DMA_TIMER->SR = 0;
+  TMC_DMA_TIMER->DIER = TIM_DIER_UDE;
+  TMC_DMA_STREAM->CR |= DMA_SxCR_EN;
+  TMC_DMA_TIMER->CR1 |= TIM_CR1_CEN;
+}
+
+TMCSerialDMA::TMCSerialDMA(const pin_t pin) : pin(pin), rx_head(0), rx_tail(0), rx_pos(0) {
+  const PinName pn = digitalPinToPinName(pin);
+  port = get_GPIO_Port(STM_PORT(pn));
+  index = STM_PIN(pn);
+  mask = _BV(index);
+}
+
+void TMCSerialDMA::begin(const uint32_t baud) {
+  static bool bus_ready = false;
+  if (!bus_ready) {
+    bus_ready = true;
+    __HAL_RCC_DMA2_CLK_ENABLE();
+    __HAL_RCC_TIM8_CLK_ENABLE();
+    TMC_DMA_TIMER->CR1 = 0;
+    TMC_DMA_TIMER->PSC = 0;
+    HAL_NVIC_SetPriority(TMC_DMA_IRQn, TMC_SERIAL_DMA_IRQ_PRIO, 0);
+    HAL_NVIC_EnableIRQ(TMC_DMA_IRQn);
+  }
+
+  // TIM8 is on APB2 and runs at twice the bus clock when the bus is divided
+  uint32_t clk = HAL_RCC_GetPCLK2Freq();
+  if ((RCC->CFGR & RCC_CFGR_PPRE2) != RCC_CFGR_PPRE2_DIV1) clk *= 2;
+  bit_ticks = _MIN(clk / baud, uint32_t(UINT16_MAX));
+
+  // Idle high. The pull-up holds the line high while the pin is released.
+  pinMode(pin, OUTPUT);
+  port->PUPDR = (port->PUPDR & ~(3UL << (index * 2))) | (1UL << (index * 2));
+  drive_pin();
+}
+
+// Queue one byte as start bit, 8 data bits (LSB first) and stop bit
+size_t TMCSerialDMA::write(uint8_t c) {
+  // Let another driver's datagram go out first, or wait for room
+  while (bus_state == BUS_TX && (owner != this || tx_count > COUNT(tx_words) - 10)) { /* nada */ }
+
+  CRITICAL_SECTION_START();
+  const bool start = bus_state != BUS_TX;
+  if (start) {
+    bus_stop();                         // End the capture of any earlier reply
+    owner = this;
+    tx_count = tx_sent = 0;
+  }
+  uint32_t *w = &tx_words[tx_count];
+  *w++ = uint32_t(mask) << 16;
+  LOOP_L_N(i, 8) *w++ = TEST(c, i) ? mask : uint32_t(mask) << 16;
+  *w = mask;
+  tx_count += 10;
+  if (start) send();
+  CRITICAL_SECTION_END();
+  return 1;
+}
+
+// Clock out the queued words. Called with the bus stopped.
+void TMCSerialDMA::send() {
+  drive_pin();
+  bus_start(DMA_SxCR_DIR_0 | DMA_SxCR_MSIZE_1 | DMA_SxCR_PSIZE_1, &port->BSRR, &tx_words[tx_sent], tx_count - tx_sent, bit_ticks);
+  tx_sent = tx_count;
+  bus_state = BUS_TX;
+}
+
+// Release the line and sample the byte of the input register that holds the pin
+void TMCSerialDMA::capture() {
+  release_pin();
+  rx_head = rx_tail = 0;
+  rx_pos = 0;
+  bus_start(0, (volatile uint8_t *)&port->IDR + (index >> 3), rx_samples, COUNT(rx_samples), bit_ticks / (OVERSAMPLE));
+  bus_state = BUS_RX;
+}
+
+void TMCSerialDMA::dma_isr() {
+  DMA2->LIFCR = TMC_DMA_FLAGS;
+  if (bus_state == BUS_TX) {
+    // The last stop bit has started. Send bytes written meanwhile or listen for the reply.
+    if (tx_sent != tx_count) owner->send(); else owner->capture();
+  }
+  else {
+    bus_stop();
+    bus_state = BUS_IDLE;
+  }
+}
+
+extern "C" void DMA2_Stream1_IRQHandler() { TMCSerialDMA::dma_isr(); }
+
+// Decode whole frames from the samples taken so far
+void TMCSerialDMA::decode() {
+  if (owner != this) return;
+  const BusState state = bus_state;
+  const uint16_t got = state == BUS_TX ? 0 : state == BUS_RX ? COUNT(rx_samples) - TMC_DMA_STREAM->NDTR : COUNT(rx_samples);
+  const uint8_t bit = _BV(index & 7);
+  while (rx_pos + 10 * (OVERSAMPLE) <= got) {
+    // Look for the falling edge of a start bit
+    if (rx_samples[rx_pos] & bit) { rx_pos++; continue; }
+    // Sample the data bits in the middle
+    uint8_t c = 0;
+    LOOP_L_N(i, 8) if (rx_samples[rx_pos + (i + 1) * (OVERSAMPLE) + (OVERSAMPLE) / 2] & bit) SBI(c, i);
+    if (rx_head < sizeof(rx_data)) rx_data[rx_head++] = c;
+    rx_pos += 9 * (OVERSAMPLE) + (OVERSAMPLE) / 2; // Middle of the stop bit
+  }
+}
+
+int TMCSerialDMA::available() { decode(); return rx_head - rx_tail; }
+int TMCSerialDMA::read()      { decode(); return rx_tail < rx_head ? rx_data[rx_tail++] : -1; }
+int TMCSerialDMA::peek()      { decode(); return rx_tail < rx_head ? rx_data[rx_tail] : -1; }
+void TMCSerialDMA::flush()    { while (bus_state == BUS_TX) { /* nada */ } }
+
+#endif // HAS_TMC_DMA_SERIAL
+#endif // HAL_STM32
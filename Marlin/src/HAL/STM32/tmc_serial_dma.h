@@ -0,0 +1,66 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Single-wire serial for TMC2208/TMC2209 drivers, driven by a timer and DMA.
+ *
+ * Written bytes are turned into one GPIO BSRR word per bit, which DMA copies
+ * out on each timer update. After the last stop bit the pin is released and
+ * the port is sampled at OVERSAMPLE times the baud rate into a buffer, which
+ * read() decodes. All instances share the one timer and DMA stream, so only
+ * the driver that wrote last gets a reply.
+ */
+
+#include <Stream.h>
+
+class TMCSerialDMA : public Stream {
+public:
+  TMCSerialDMA(const pin_t pin);
+
+  void begin(const uint32_t baud);
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t write(uint8_t c) override;
+  void flush() override;
+  using Print::write;
+
+  static void dma_isr();
+
+private:
+  const pin_t pin;      // Single-wire TX/RX pin
+  GPIO_TypeDef *port;   // GPIO port of the pin
+  uint16_t mask;        // Pin bit in the port
+  uint8_t index;        // Pin number in the port, 0-15
+
+  uint8_t rx_data[12];  // Decoded reply bytes
+  uint8_t rx_head, rx_tail;
+  uint16_t rx_pos;      // Next sample to decode
+
+  void decode();
+  void send();
+  void capture();
+  void release_pin() { port->MODER &= ~(3UL << (index * 2)); }
+  void drive_pin()   { port->BSRR = mask; port->MODER = (port->MODER & ~(3UL << (index * 2))) | (1UL << (index * 2)); }
+};
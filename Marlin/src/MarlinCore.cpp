@@ -198,6 +198,10 @@
   #include "feature/hotend_idle.h"
 #endif
 
+#if ENABLED(PREDICTIVE_HEATUP)
+  #include "feature/predictive_heatup.h"
+#endif
+
 #if ENABLED(TEMP_STAT_LEDS)
   #include "feature/leds/tempstat.h"
 #endif
@@ -662,6 +666,8 @@ inline void manage_inactivity(const bool no_stepper_sleep=false) {
 
   TERN_(HOTEND_IDLE_TIMEOUT, hotend_idle.check());
 
+  TERN_(PREDICTIVE_HEATUP, predictive_heatup.task());
+
   #if ENABLED(EXTRUDER_RUNOUT_PREVENT)
     if (thermalManager.degHotend(active_extruder) > (EXTRUDER_RUNOUT_MINTEMP)
       && ELAPSED(ms, gcode.previous_move_ms + SEC_TO_MS(EXTRUDER_RUNOUT_SECONDS))
@@ -827,6 +833,9 @@ void idle(bool no_stepper_sleep/*=false*/) {
   // Handle SD Card insert / remove
   TERN_(SDSUPPORT, card.manage_media());
 
+  // Map free FAT clusters in the background
+  TERN_(SD_FREE_CLUSTER_MAP, card.build_free_map());
+
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, card.diskIODriver()->idle());
 
@@ -906,9 +915,12 @@ void kill(FSTR_P const lcd_error/*=nullptr*/, FSTR_P const lcd_component/*=nullp
 
   // "Error:Printer halted. kill() called!"
   SERIAL_ERROR_MSG(STR_ERR_KILLED);
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
-  SERIAL_ECHOPGM("page halt");
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
+  {
+    CHANNEL_REDIRECT(PANEL);
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+    SERIAL_ECHOPGM("page halt");
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+  }
 
   #ifdef ACTION_ON_KILL
     hostui.kill();
@@ -52,39 +52,47 @@
 #undef DEBUG_XYZ
 #undef DEBUG_DELAY
 #undef DEBUG_SYNCHRONIZE
+#undef _DEBUG_OUT
 
 #if DEBUG_OUT
 
   #include "debug_section.h"
-  #define DEBUG_SECTION(N,S,D)    SectionLog N(F(S),D)
+  #define DEBUG_SECTION(N,S,D)        SectionLog N(F(S),D)
 
-  #define DEBUG_ECHO_START        SERIAL_ECHO_START
-  #define DEBUG_ERROR_START       SERIAL_ERROR_START
-  #define DEBUG_CHAR              SERIAL_CHAR
-  #define DEBUG_ECHO              SERIAL_ECHO
-  #define DEBUG_DECIMAL           SERIAL_DECIMAL
-  #define DEBUG_ECHO_F            SERIAL_ECHO_F
-  #define DEBUG_ECHOLN            SERIAL_ECHOLN
-  #define DEBUG_ECHOPGM           SERIAL_ECHOPGM
-  #define DEBUG_ECHOLNPGM         SERIAL_ECHOLNPGM
-  #define DEBUG_ECHOF             SERIAL_ECHOF
-  #define DEBUG_ECHOLNF           SERIAL_ECHOLNF
-  #define DEBUG_ECHOPGM           SERIAL_ECHOPGM
-  #define DEBUG_ECHOPGM_P         SERIAL_ECHOPGM_P
-  #define DEBUG_ECHOPAIR_F        SERIAL_ECHOPAIR_F
-  #define DEBUG_ECHOPAIR_F_P      SERIAL_ECHOPAIR_F_P
-  #define DEBUG_ECHOLNPGM         SERIAL_ECHOLNPGM
-  #define DEBUG_ECHOLNPGM_P       SERIAL_ECHOLNPGM_P
-  #define DEBUG_ECHOLNPAIR_F      SERIAL_ECHOLNPAIR_F
-  #define DEBUG_ECHOLNPAIR_F_P    SERIAL_ECHOLNPAIR_F_P
-  #define DEBUG_ECHO_MSG          SERIAL_ECHO_MSG
-  #define DEBUG_ERROR_MSG         SERIAL_ERROR_MSG
-  #define DEBUG_EOL               SERIAL_EOL
-  #define DEBUG_FLUSH             SERIAL_FLUSH
-  #define DEBUG_POS               SERIAL_POS
-  #define DEBUG_XYZ               SERIAL_XYZ
-  #define DEBUG_DELAY(ms)         serial_delay(ms)
-  #define DEBUG_SYNCHRONIZE()     planner.synchronize()
+  // Debugging output goes to the DEBUG output channel
+  #if BOTH(HAS_MULTI_SERIAL, SERIAL_OUTPUT_CHANNELS)
+    #define _DEBUG_OUT(V)             do{ CHANNEL_REDIRECT(DEBUG); V; }while(0)
+  #else
+    #define _DEBUG_OUT(V)             V
+  #endif
+
+  #define DEBUG_ECHO_START(V...)      _DEBUG_OUT(SERIAL_ECHO_START(V))
+  #define DEBUG_ERROR_START(V...)     _DEBUG_OUT(SERIAL_ERROR_START(V))
+  #define DEBUG_CHAR(V...)            _DEBUG_OUT(SERIAL_CHAR(V))
+  #define DEBUG_ECHO(V...)            _DEBUG_OUT(SERIAL_ECHO(V))
+  #define DEBUG_DECIMAL(V...)         _DEBUG_OUT(SERIAL_DECIMAL(V))
+  #define DEBUG_ECHO_F(V...)          _DEBUG_OUT(SERIAL_ECHO_F(V))
+  #define DEBUG_ECHOLN(V...)          _DEBUG_OUT(SERIAL_ECHOLN(V))
+  #define DEBUG_ECHOPGM(V...)         _DEBUG_OUT(SERIAL_ECHOPGM(V))
+  #define DEBUG_ECHOLNPGM(V...)       _DEBUG_OUT(SERIAL_ECHOLNPGM(V))
+  #define DEBUG_ECHOF(V...)           _DEBUG_OUT(SERIAL_ECHOF(V))
+  #define DEBUG_ECHOLNF(V...)         _DEBUG_OUT(SERIAL_ECHOLNF(V))
+  #define DEBUG_ECHOPGM(V...)         _DEBUG_OUT(SERIAL_ECHOPGM(V))
+  #define DEBUG_ECHOPGM_P(V...)       _DEBUG_OUT(SERIAL_ECHOPGM_P(V))
+  #define DEBUG_ECHOPAIR_F(V...)      _DEBUG_OUT(SERIAL_ECHOPAIR_F(V))
+  #define DEBUG_ECHOPAIR_F_P(V...)    _DEBUG_OUT(SERIAL_ECHOPAIR_F_P(V))
+  #define DEBUG_ECHOLNPGM(V...)       _DEBUG_OUT(SERIAL_ECHOLNPGM(V))
+  #define DEBUG_ECHOLNPGM_P(V...)     _DEBUG_OUT(SERIAL_ECHOLNPGM_P(V))
+  #define DEBUG_ECHOLNPAIR_F(V...)    _DEBUG_OUT(SERIAL_ECHOLNPAIR_F(V))
+  #define DEBUG_ECHOLNPAIR_F_P(V...)  _DEBUG_OUT(SERIAL_ECHOLNPAIR_F_P(V))
+  #define DEBUG_ECHO_MSG(V...)        _DEBUG_OUT(SERIAL_ECHO_MSG(V))
+  #define DEBUG_ERROR_MSG(V...)       _DEBUG_OUT(SERIAL_ERROR_MSG(V))
+  #define DEBUG_EOL(V...)             _DEBUG_OUT(SERIAL_EOL(V))
+  #define DEBUG_FLUSH                 SERIAL_FLUSH
+  #define DEBUG_POS(V...)             _DEBUG_OUT(SERIAL_POS(V))
+  #define DEBUG_XYZ(V...)             _DEBUG_OUT(SERIAL_XYZ(V))
+  #define DEBUG_DELAY(ms)             serial_delay(ms)
+  #define DEBUG_SYNCHRONIZE()         planner.synchronize()
 
 #else
 
@@ -113,7 +121,7 @@
   #define DEBUG_POS(...)            NOOP
   #define DEBUG_XYZ(...)            NOOP
   #define DEBUG_DELAY(...)          NOOP
-  #define DEBUG_SYNCHRONIZE()       NOOP
+  #define DEBUG_SYNCHRONIZE()         NOOP
 
 #endif
 
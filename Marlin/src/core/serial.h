@@ -127,9 +127,23 @@ extern uint8_t marlin_debug_flags;
 
 #define SERIAL_OUT(WHAT, V...)  (void)SERIAL_IMPL.WHAT(V)
 
+//
+// Output channels
+// With SERIAL_OUTPUT_CHANNELS each kind of output (HOST, PANEL, DEBUG) only goes to the
+// ports subscribed to it. Replies go to the sending port if it subscribes to HOST output.
+//
+#if BOTH(HAS_MULTI_SERIAL, SERIAL_OUTPUT_CHANNELS)
+  #define SERIAL_CHANNEL_MASK(C) SerialMask(SERIAL_##C##_PORTS)
+  #define CHANNEL_REDIRECT(C)    _PORT_REDIRECT(C,SERIAL_CHANNEL_MASK(C))
+  #define SERIAL_PORTMASK(P)     SerialMask::from(P).filter(SERIAL_CHANNEL_MASK(HOST))
+#else
+  #define SERIAL_CHANNEL_MASK(C) SerialMask(SerialMask::All)
+  #define CHANNEL_REDIRECT(C)    NOOP
+  #define SERIAL_PORTMASK(P)     SerialMask::from(P)
+#endif
+
 #define PORT_REDIRECT(p)   _PORT_REDIRECT(1,p)
 #define PORT_RESTORE()     _PORT_RESTORE(1)
-#define SERIAL_PORTMASK(P) SerialMask::from(P)
 
 //
 // SERIAL_CHAR - Print one or more individual chars
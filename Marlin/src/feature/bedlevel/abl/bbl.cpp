@@ -27,6 +27,7 @@
 #include "../bedlevel.h"
 
 #include "../../../module/motion.h"
+#include "../../../module/planner.h"
 
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../../core/debug_out.h"
@@ -264,6 +265,7 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values /*= NULL*
 // Refresh after other values have been updated
 void LevelingBilinear::refresh_bed_level() {
   TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+  TERN_(ABL_CELL_COEFFICIENTS, refresh_cell_coefficients());
   cached_rel.x = cached_rel.y = -999.999;
   cached_g.x = cached_g.y = -99;
 }
@@ -282,15 +284,44 @@ void LevelingBilinear::refresh_bed_level() {
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
+#if ENABLED(ABL_CELL_COEFFICIENTS)
+
+  LevelingBilinear::cell_coeff_t LevelingBilinear::cell_coeff[TERN(ABL_BILINEAR_SUBDIVISION, ABL_GRID_POINTS_VIRT_X, GRID_MAX_POINTS_X)]
+                                                            [TERN(ABL_BILINEAR_SUBDIVISION, ABL_GRID_POINTS_VIRT_Y, GRID_MAX_POINTS_Y)];
+
+  /**
+   * Expand the bilinear blend of each cell's corners into a polynomial of the
+   * in-cell ratios. The last row and column pair each point with itself, as
+   * get_z_correction does at the far edge.
+   */
+  void LevelingBilinear::refresh_cell_coefficients() {
+    LOOP_L_N(x, ABL_BG_POINTS_X) {
+      const uint8_t nx = _MIN(x + 1, ABL_BG_POINTS_X - 1);
+      LOOP_L_N(y, ABL_BG_POINTS_Y) {
+        const uint8_t ny = _MIN(y + 1, ABL_BG_POINTS_Y - 1);
+        cell_coeff[x][y].set(ABL_BG_GRID(x, y), ABL_BG_GRID(x, ny), ABL_BG_GRID(nx, y), ABL_BG_GRID(nx, ny));
+      }
+    }
+  }
+
+#endif
+
+// Without cell terms keep the corners of the last cell and the blend along Y
+#if DISABLED(ABL_CELL_COEFFICIENTS)
+  #define ABL_CORNER_CACHE 1
+#endif
+
 // Get the Z adjustment for non-linear bed leveling
 float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
-  static float z1, d2, z3, d4, L, D;
+  #if ENABLED(ABL_CORNER_CACHE)
+    static float z1, d2, z3, d4, L, D;
+  #endif
 
   static xy_pos_t ratio;
 
   // Whole units for the grid line indices. Constrained within bounds.
-  static xy_int8_t thisg, nextg;
+  static xy_int8_t thisg OPTARG(ABL_CORNER_CACHE, nextg);
 
   // XY relative to the probed area
   xy_pos_t rel = raw - grid_start.asFloat();
@@ -313,60 +344,70 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
     #endif
 
     thisg.x = gx;
-    nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
+    TERN_(ABL_CORNER_CACHE, nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1));
   }
 
-  if (cached_rel.y != rel.y || cached_g.x != thisg.x) {
+  const bool new_y = cached_rel.y != rel.y;
+  if (new_y) {
+    cached_rel.y = rel.y;
+    ratio.y = rel.y * ABL_BG_FACTOR(y);
+    const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
+    ratio.y -= gy;
 
-    if (cached_rel.y != rel.y) {
-      cached_rel.y = rel.y;
-      ratio.y = rel.y * ABL_BG_FACTOR(y);
-      const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
-      ratio.y -= gy;
+    #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+      // Beyond the grid maintain height at grid edges
+      NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
+    #endif
 
-      #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
-        // Beyond the grid maintain height at grid edges
-        NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
-      #endif
+    thisg.y = gy;
+    TERN_(ABL_CORNER_CACHE, nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1));
+  }
 
-      thisg.y = gy;
-      nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
-    }
+  #if ENABLED(ABL_CELL_COEFFICIENTS)
 
-    if (cached_g != thisg) {
-      cached_g = thisg;
-      // Z at the box corners
-      z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
-      d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
-      z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
-      d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
-    }
+    // The cell terms already hold the corner heights and deltas
+    return cell_coeff[thisg.x][thisg.y].at(ratio.x, ratio.y);
 
-    // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
-                L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
-    const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+  #else
 
-    D = R - L;
-  }
+    if (new_y || cached_g.x != thisg.x) {
 
-  const float offset = L + ratio.x * D;   // the offset almost always changes
+      if (cached_g != thisg) {
+        cached_g = thisg;
+        // Z at the box corners
+        z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
+        d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
+        z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
+        d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
+      }
 
-  /*
-  static float last_offset = 0;
-  if (ABS(last_offset - offset) > 0.2) {
-    SERIAL_ECHOLNPGM("Sudden Shift at x=", rel.x, " / ", grid_spacing.x, " -> thisg.x=", thisg.x);
-    SERIAL_ECHOLNPGM(" y=", rel.y, " / ", grid_spacing.y, " -> thisg.y=", thisg.y);
-    SERIAL_ECHOLNPGM(" ratio.x=", ratio.x, " ratio.y=", ratio.y);
-    SERIAL_ECHOLNPGM(" z1=", z1, " z2=", z2, " z3=", z3, " z4=", z4);
-    SERIAL_ECHOLNPGM(" L=", L, " R=", R, " offset=", offset);
-  }
-  last_offset = offset;
-  //*/
+      // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
+                  L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
+      const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+
+      D = R - L;
+    }
+
+    const float offset = L + ratio.x * D;   // the offset almost always changes
+
+    /*
+    static float last_offset = 0;
+    if (ABS(last_offset - offset) > 0.2) {
+      SERIAL_ECHOLNPGM("Sudden Shift at x=", rel.x, " / ", grid_spacing.x, " -> thisg.x=", thisg.x);
+      SERIAL_ECHOLNPGM(" y=", rel.y, " / ", grid_spacing.y, " -> thisg.y=", thisg.y);
+      SERIAL_ECHOLNPGM(" ratio.x=", ratio.x, " ratio.y=", ratio.y);
+      SERIAL_ECHOLNPGM(" z1=", z1, " z2=", z2, " z3=", z3, " z4=", z4);
+      SERIAL_ECHOLNPGM(" L=", L, " R=", R, " offset=", offset);
+    }
+    last_offset = offset;
+    //*/
+
+    return offset;
 
-  return offset;
+  #endif
 }
 
-#if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+#if IS_CARTESIAN && (DISABLED(SEGMENT_LEVELED_MOVES) || ENABLED(SEGMENT_LEVELED_CELLS))
 
   #define CELL_INDEX(A,V) ((V - grid_start.A) * ABL_BG_FACTOR(A))
 
@@ -385,8 +426,7 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
     // Start and end in the same cell? No split needed.
     if (c1 == c2) {
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
+      cell_line_to_destination(scaled_fr_mm_s, c1);
       return;
     }
 
@@ -418,8 +458,7 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
     else {
       // Must already have been split on these border(s)
       // This should be a rare case.
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
+      cell_line_to_destination(scaled_fr_mm_s, c1);
       return;
     }
 
@@ -434,6 +473,34 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
     line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
   }
 
-#endif // IS_CARTESIAN && !SEGMENT_LEVELED_MOVES
+  /**
+   * Move to the destination within one grid cell. Along a straight line the
+   * bilinear height is a parabola whose sag below the chord is a quarter of
+   * the cell's twist term times the X and Y spans (in cells). With
+   * SEGMENT_LEVELED_CELLS the move is divided just enough to keep that sag
+   * within LEVELED_CELL_TOLERANCE.
+   */
+  void LevelingBilinear::cell_line_to_destination(const_feedRate_t scaled_fr_mm_s, const xy_int_t &cell) {
+    #if ENABLED(SEGMENT_LEVELED_CELLS)
+      const float twist = ABL_BG_GRID(cell.x + 1, cell.y + 1) - ABL_BG_GRID(cell.x + 1, cell.y)
+                        - ABL_BG_GRID(cell.x, cell.y + 1) + ABL_BG_GRID(cell.x, cell.y),
+                  sag = 0.25f * ABS(twist * (destination.x - current_position.x) * ABL_BG_FACTOR(x)
+                                          * (destination.y - current_position.y) * ABL_BG_FACTOR(y));
+      if (sag > LEVELED_CELL_TOLERANCE) {
+        // The sag shrinks with the square of the number of segments
+        uint16_t segments = CEIL(SQRT(sag * RECIPROCAL(LEVELED_CELL_TOLERANCE)));
+        const xyze_float_t segment_distance = (destination - current_position) * RECIPROCAL(segments);
+        xyze_pos_t raw = current_position;
+        while (--segments) {
+          raw += segment_distance;
+          if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder)) break;
+        }
+      }
+    #endif
+    current_position = destination;
+    line_to_current_position(scaled_fr_mm_s);
+  }
+
+#endif // IS_CARTESIAN && (!SEGMENT_LEVELED_MOVES || SEGMENT_LEVELED_CELLS)
 
 #endif // AUTO_BED_LEVELING_BILINEAR
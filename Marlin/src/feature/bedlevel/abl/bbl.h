@@ -23,6 +23,10 @@
 
 #include "../../../inc/MarlinConfigPre.h"
 
+#if ENABLED(ABL_CELL_COEFFICIENTS)
+  #include "bbl_cell.h"
+#endif
+
 class LevelingBilinear {
 public:
   static bed_mesh_t z_values;
@@ -49,6 +53,13 @@ private:
     static void bed_level_virt_interpolate();
   #endif
 
+  #if ENABLED(ABL_CELL_COEFFICIENTS)
+    typedef TERN(ABL_CELL_FIXED_POINT, bbl_cell_fixed_t, bbl_cell_float_t) cell_coeff_t;
+    static cell_coeff_t cell_coeff[TERN(ABL_BILINEAR_SUBDIVISION, ABL_GRID_POINTS_VIRT_X, GRID_MAX_POINTS_X)]
+                                  [TERN(ABL_BILINEAR_SUBDIVISION, ABL_GRID_POINTS_VIRT_Y, GRID_MAX_POINTS_Y)];
+    static void refresh_cell_coefficients();
+  #endif
+
 public:
   static void reset();
   static void set_grid(const xy_pos_t& _grid_spacing, const xy_pos_t& _grid_start);
@@ -62,8 +73,9 @@ public:
   static float get_z_correction(const xy_pos_t &raw);
   static constexpr float get_z_offset() { return 0.0f; }
 
-  #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+  #if IS_CARTESIAN && (DISABLED(SEGMENT_LEVELED_MOVES) || ENABLED(SEGMENT_LEVELED_CELLS))
     static void line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits=0xFFFF, uint16_t y_splits=0xFFFF);
+    static void cell_line_to_destination(const_feedRate_t scaled_fr_mm_s, const xy_int_t &cell);
   #endif
 };
 
@@ -0,0 +1,78 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * bbl_cell.h - Precomputed bilinear cell terms for ABL_CELL_COEFFICIENTS
+ *
+ * The bilinear blend of a cell's four corners, expanded into a polynomial of
+ * the in-cell ratios rx and ry:
+ *
+ *   Z = z + dx * rx + ry * (dy + dxy * rx)
+ *
+ * The corners are given as left-front, left-back, right-front and right-back.
+ * No configuration is needed, so the host unit tests can use these directly.
+ */
+
+#include <stdint.h>
+#include <math.h>
+
+struct bbl_cell_float_t {
+  float z, dx, dy, dxy;
+
+  void set(const float z1, const float z2, const float z3, const float z4) {
+    z = z1;
+    dx = z3 - z1;
+    dy = z2 - z1;
+    dxy = (z4 - z3) - dy;
+  }
+
+  float at(const float rx, const float ry) const { return z + rx * dx + ry * (dy + rx * dxy); }
+};
+
+/**
+ * The same terms in Q16.16 fixed point, for MCUs without an FPU.
+ * Steps of 1/65536mm are far finer than any motion. An unprobed (NAN)
+ * corner reads as 0, as there is no fixed-point NAN.
+ */
+struct bbl_cell_fixed_t {
+  int32_t z, dx, dy, dxy;
+
+  static int32_t to_fixed(const float f) { return isfinite(f) ? int32_t(f * 65536.0f + (f < 0 ? -0.5f : 0.5f)) : 0; }
+  static float to_float(const int32_t q) { return q * (1.0f / 65536.0f); }
+
+  void set(const float z1, const float z2, const float z3, const float z4) {
+    const int32_t q1 = to_fixed(z1), q2 = to_fixed(z2), q3 = to_fixed(z3), q4 = to_fixed(z4);
+    z = q1;
+    dx = q3 - q1;
+    dy = q2 - q1;
+    dxy = (q4 - q3) - dy;
+  }
+
+  // Ratios in Q16.16. Products are rounded to the nearest step.
+  int32_t at_fixed(const int32_t rx, const int32_t ry) const {
+    const int32_t y = dy + int32_t((int64_t(rx) * dxy + 0x8000) >> 16);
+    return z + int32_t((int64_t(rx) * dx + int64_t(ry) * y + 0x8000) >> 16);
+  }
+
+  float at(const float rx, const float ry) const { return to_float(at_fixed(to_fixed(rx), to_fixed(ry))); }
+};
@@ -33,4 +33,92 @@ bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_tran
 
 BinaryStream binaryStream[NUM_SERIAL];
 
+#if ENABLED(BINARY_MOTION_STREAM)
+
+#include "../MarlinCore.h"
+#include "../module/motion.h"
+
+#define MOTION_AXIS_BITS (_BV(LOGICAL_AXES) - 1)
+
+static uint16_t read_flags(const uint8_t *data) { uint16_t v; memcpy(&v, data, sizeof(v)); return v; }
+
+static int32_t read_fixed(const uint8_t* &data) {
+  int32_t v;
+  memcpy(&v, data, sizeof(v));
+  data += sizeof(v);
+  return v;
+}
+
+// Size of a move, from its flags
+static uint16_t move_size(const uint16_t flags) {
+  return sizeof(flags) + sizeof(int32_t) * __builtin_popcount(flags & (MOTION_AXIS_BITS | BinaryMotionProtocol::FLAG_FEEDRATE));
+}
+
+/**
+ * Check the whole packet before any of it is run,
+ * so a bad packet never leaves a partial path behind.
+ */
+bool BinaryMotionProtocol::moves_valid(const uint8_t *data, uint16_t length) {
+  if (!length) return false;
+  while (length) {
+    if (length < sizeof(uint16_t)) return false;
+    const uint16_t flags = read_flags(data);
+    if (flags & ~(MOTION_AXIS_BITS | FLAG_FEEDRATE | FLAG_RELATIVE)) return false;
+    const uint16_t size = move_size(flags);
+    if (size > length) return false;
+    data += size;
+    length -= size;
+  }
+  return true;
+}
+
+/**
+ * Apply each move the way G1 would after parsing,
+ * handing the destination straight to the motion system.
+ */
+void BinaryMotionProtocol::do_moves(const uint8_t *data, uint16_t length) {
+  constexpr float scale = 1.0f / SCALE;
+  while (length) {
+    const uint16_t flags = read_flags(data);
+    length -= move_size(flags);
+    data += sizeof(flags);
+
+    if (homing_needed_error(flags & main_axes_mask)) return;
+
+    const bool relative = flags & FLAG_RELATIVE;
+    destination = current_position;
+    LOOP_LOGICAL_AXES(i) if (TEST(flags, i)) {
+      const float v = read_fixed(data) * scale;
+      destination[i] = relative ? current_position[i] + v
+                     : TERN0(HAS_EXTRUDERS, i == E_AXIS) ? v
+                     : LOGICAL_TO_NATIVE(v, i);
+    }
+    if (flags & FLAG_FEEDRATE) feedrate_mm_s = MMM_TO_MMS(read_fixed(data) * scale);
+
+    prepare_line_to_destination();
+  }
+}
+
+void BinaryMotionProtocol::process(uint8_t packet_type, char *buffer, const uint16_t length) {
+  const uint8_t * const data = reinterpret_cast<const uint8_t*>(buffer);
+  switch (static_cast<Motion>(packet_type)) {
+    case Motion::QUERY:
+      SERIAL_ECHOLNPGM("PMS:version:", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH, ":scale:", SCALE, ":axes:", LOGICAL_AXES);
+      break;
+    case Motion::MOVE:
+      if (!moves_valid(data, length))
+        SERIAL_ECHOLNPGM("PMS:invalid");
+      else if (!IsRunning())
+        SERIAL_ECHOLNPGM("PMS:stopped");
+      else
+        do_moves(data, length);
+      break;
+    default:
+      SERIAL_ECHOLNPGM("PMS:invalid");
+      break;
+  }
+}
+
+#endif // BINARY_MOTION_STREAM
+
 #endif
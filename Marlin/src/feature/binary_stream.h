@@ -197,9 +197,37 @@ public:
   static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0, TIMEOUT = 10000, IDLE_PERIOD = 1000;
 };
 
+#if ENABLED(BINARY_MOTION_STREAM)
+
+  /**
+   * Compact motion stream
+   *
+   * A MOVE packet holds one or more moves. Each move is a 16-bit flags word
+   * followed by a little-endian int32 for every flagged field, in this order:
+   *   bits 0..LOGICAL_AXES-1 : Axis target (or offset if relative) in 1/SCALE mm
+   *   bit 14                 : Feedrate in 1/SCALE mm/min
+   * Bit 15 makes the axis values of the move relative.
+   */
+  class BinaryMotionProtocol {
+  public:
+    static void process(uint8_t packet_type, char *buffer, const uint16_t length);
+
+    static constexpr uint16_t FLAG_FEEDRATE = _BV(14), FLAG_RELATIVE = _BV(15);
+    static constexpr int32_t SCALE = 1000;
+    static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0;
+
+  private:
+    enum class Motion : uint8_t { QUERY, MOVE };
+
+    static bool moves_valid(const uint8_t *data, uint16_t length);
+    static void do_moves(const uint8_t *data, uint16_t length);
+  };
+
+#endif
+
 class BinaryStream {
 public:
-  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER };
+  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER, MOTION };
 
   enum class ProtocolControl : uint8_t { SYNC = 1, CLOSE };
 
@@ -393,6 +421,16 @@ public:
           packet_retries = 0;
           bytes_received += packet.header.size;
 
+          #if ENABLED(BINARY_MOTION_STREAM)
+            // Like an ASCII "ok", moves are acknowledged once they are in the planner
+            if (static_cast<Protocol>(packet.header.protocol()) == Protocol::MOTION) {
+              dispatch();
+              SERIAL_ECHOLNPGM("ok", packet.header.sync);
+              stream_state = StreamState::PACKET_RESET;
+              break;
+            }
+          #endif
+
           SERIAL_ECHOLNPGM("ok", packet.header.sync); // transmit valid packet received
           dispatch();
           stream_state = StreamState::PACKET_RESET;
@@ -436,6 +474,11 @@ public:
       case Protocol::FILE_TRANSFER:
         SDFileTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size); // send user data to be processed
       break;
+      #if ENABLED(BINARY_MOTION_STREAM)
+        case Protocol::MOTION:
+          BinaryMotionProtocol::process(packet.header.type(), packet.buffer, packet.header.size);
+        break;
+      #endif
       default:
         SERIAL_ECHO_MSG("Unsupported Binary Protocol");
     }
@@ -0,0 +1,225 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Compiled Jobs
+ *
+ * The first time a file is printed from the start, each line committed to
+ * the queue is stored in a sidecar next to it (the same 8.3 name with a .PGC
+ * extension) together with the state the parser produced for it. When the
+ * file is opened again with the same size and write stamp the queue is filled
+ * from the sidecar and every command is loaded into the parser as it was,
+ * without being parsed. The sidecar also holds the time estimate, so the
+ * source header isn't read either.
+ *
+ * Anything that moves the print position other than reading straight through
+ * (repeat markers, resume, sub-procedures) abandons the compile, or falls back
+ * to the source text from the current position.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SD_COMPILED_JOBS)
+
+#include "compiled_job.h"
+#include "../sd/cardreader.h"
+#include "../gcode/parser.h"
+
+// Sidecars from a build that parses differently are not used
+#define COMPILED_JOB_VERSION (0x20 \
+  | ENABLED(GCODE_CASE_INSENSITIVE) \
+  | ENABLED(GCODE_QUOTED_STRINGS) << 1 \
+  | ENABLED(USE_GCODE_SUBCODES) << 2 \
+  | ENABLED(REALTIME_REPORTING_COMMANDS) << 3 \
+  | ENABLED(EMERGENCY_OVERRIDES) << 4 \
+)
+
+CompiledJob compiled_job;
+
+CompiledJob::State CompiledJob::state; // = IDLE
+CompiledJob::Header CompiledJob::header;
+SdFile CompiledJob::dir, CompiledJob::sidecar;
+char CompiledJob::name[FILENAME_LENGTH];
+uint32_t CompiledJob::pos, CompiledJob::lines;
+uint8_t CompiledJob::block[512];
+uint16_t CompiledJob::block_len, CompiledJob::block_index;
+
+// Get the size and write stamp of the source and the name of its sidecar
+bool CompiledJob::source_info(SdFile * const d, SdFile &src) {
+  dir_t entry;
+  if (!src.dirEntry(&entry) || !src.getDosName(name)) return false;
+  char * const ext = strchr(name, '.');
+  strcpy(ext ?: name + strlen(name), ".PGC");
+  header.size = src.fileSize();
+  header.date = entry.lastWriteDate;
+  header.time = entry.lastWriteTime;
+  dir = *d;
+  return true;
+}
+
+bool CompiledJob::replay(SdFile * const d, SdFile &src, long &seconds) {
+  close();
+  if (!source_info(d, src) || !sidecar.open(&dir, name, O_READ)) return false;
+
+  const Header want = header;
+  block_len = block_index = 0;
+  if (!get_bytes(&header, sizeof(header))
+    || memcmp(header.magic, "PGC", 3) || header.version != (COMPILED_JOB_VERSION)
+    || header.size != want.size || header.date != want.date || header.time != want.time
+    || !header.count
+  ) {
+    sidecar.close();
+    return false;
+  }
+
+  seconds = header.seconds;
+  pos = lines = 0;
+  state = REPLAY;
+  return true;
+}
+
+void CompiledJob::prepare(SdFile * const d, SdFile &src, const long seconds) {
+  close();
+  if (!source_info(d, src)) return;
+  memcpy(header.magic, "PGC", 3);
+  header.version = COMPILED_JOB_VERSION;
+  header.seconds = seconds;
+  header.count = 0;
+  pos = lines = 0;
+  state = ARMED;
+}
+
+/**
+ * Store a line as [size][source end][text][parse state]. If the parse state
+ * can't be stored the line is kept as it was received, to be parsed again.
+ */
+void CompiledJob::record(char * const cmd, const uint32_t src_end) {
+  if (state != ARMED && state != COMPILE) return;
+
+  if (state == ARMED) {
+    if (!sidecar.open(&dir, name, O_CREAT | O_WRITE | O_TRUNC)) { state = IDLE; return; }
+    block_index = 0;
+    state = COMPILE;
+    if (!put_bytes(&header, sizeof(header))) return close();
+  }
+
+  static char line[MAX_CMD_SIZE];
+  uint8_t size = strlen(cmd) + 1;
+  memcpy(line, cmd, size);
+  const uint8_t compiled = parser.compile(line, sizeof(line));
+  if (compiled) size = compiled; else memcpy(line, cmd, size);
+
+  if (!put_bytes(&size, sizeof(size)) || !put_bytes(&src_end, sizeof(src_end)) || !put_bytes(line, size))
+    return close();
+
+  pos = src_end;
+  lines++;
+}
+
+bool CompiledJob::next(char * const cmd, bool &parsed) {
+  if (state != REPLAY) return false;
+
+  if (lines >= header.count) {
+    // Whatever follows the last line holds no commands
+    close();
+    card.setReplayIndex(header.size);
+    return false;
+  }
+
+  uint8_t size;
+  uint32_t src_end;
+  if (get_bytes(&size, sizeof(size)) && WITHIN(size, 1, MAX_CMD_SIZE)
+    && get_bytes(&src_end, sizeof(src_end)) && WITHIN(src_end, pos, header.size)
+    && get_bytes(cmd, size)
+  ) {
+    const uint8_t len = strnlen(cmd, size);
+    if (len < size) {
+      parsed = size > len + 1;
+      pos = src_end;
+      lines++;
+      card.setReplayIndex(src_end);
+      return true;
+    }
+  }
+
+  // A damaged sidecar hands over to the source text
+  close();
+  card.setIndex(card.getIndex());
+  return false;
+}
+
+void CompiledJob::seek(const uint32_t index) {
+  if (state != IDLE && index != pos) close();
+}
+
+void CompiledJob::finish() {
+  if (state == COMPILE) {
+    // Write out the last block, then mark the sidecar complete
+    header.count = lines;
+    if ((!block_index || sidecar.write(block, block_index) == int16_t(block_index))
+      && sidecar.seekSet(0) && sidecar.write(&header, sizeof(header)) == int16_t(sizeof(header))
+      && sidecar.sync()
+    ) {
+      sidecar.close();
+      state = IDLE;
+    }
+  }
+  close();
+}
+
+void CompiledJob::close() {
+  if (state == COMPILE) sidecar.remove();   // An unfinished sidecar is never used
+  else if (state == REPLAY) sidecar.close();
+  state = IDLE;
+}
+
+bool CompiledJob::get_bytes(void * const dst, uint8_t n) {
+  uint8_t *d = (uint8_t*)dst;
+  while (n) {
+    if (block_index >= block_len) {
+      const int16_t got = sidecar.read(block, sizeof(block));
+      if (got <= 0) return false;
+      block_len = got;
+      block_index = 0;
+    }
+    const uint8_t c = _MIN(n, block_len - block_index);
+    memcpy(d, &block[block_index], c);
+    d += c; n -= c; block_index += c;
+  }
+  return true;
+}
+
+bool CompiledJob::put_bytes(const void * const src, uint8_t n) {
+  const uint8_t *s = (const uint8_t*)src;
+  while (n) {
+    const uint8_t c = _MIN(n, sizeof(block) - block_index);
+    memcpy(&block[block_index], s, c);
+    s += c; n -= c; block_index += c;
+    if (block_index == sizeof(block)) {
+      if (sidecar.write(block, sizeof(block)) != int16_t(sizeof(block))) return false;
+      block_index = 0;
+    }
+  }
+  return true;
+}
+
+#endif // SD_COMPILED_JOBS
@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * compiled_job.h - Pre-parsed sidecar files for repeated media prints
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../sd/SdFile.h"
+
+class CompiledJob {
+public:
+  // Open a valid sidecar for the source file and get its time estimate
+  static bool replay(SdFile * const dir, SdFile &src, long &seconds);
+  // Compile the source file as it is printed from the start
+  static void prepare(SdFile * const dir, SdFile &src, const long seconds);
+
+  // Store a committed line that ends at the given source position
+  static void record(char * const cmd, const uint32_t src_end);
+  // Get the next stored line and whether it carries its parse state
+  static bool next(char * const cmd, bool &parsed);
+
+  static void seek(const uint32_t index);   // The print position is about to change
+  static void finish();                     // The source was read to the end
+  static void close();                      // Stop, discarding an unfinished sidecar
+
+  static bool replaying() { return state == REPLAY; }
+
+private:
+  enum State : uint8_t { IDLE, ARMED, COMPILE, REPLAY };
+  static State state;
+
+  struct Header {
+    char magic[3];
+    uint8_t version;
+    uint32_t size;          // Source file size
+    uint16_t date, time;    // Source file last write stamp
+    int32_t seconds;        // Time estimate from the source header
+    uint32_t count;         // Lines held, set once the sidecar is complete
+  } __attribute__((packed));
+
+  static Header header;
+  static SdFile dir, sidecar;
+  static char name[FILENAME_LENGTH];
+  static uint32_t pos,      // Source position after the last line
+                  lines;    // Lines stored or replayed
+
+  // Whole-block staging for the sidecar
+  static uint8_t block[512];
+  static uint16_t block_len, block_index;
+
+  static bool source_info(SdFile * const d, SdFile &src);
+  static bool get_bytes(void * const dst, uint8_t n);
+  static bool put_bytes(const void * const src, uint8_t n);
+};
+
+extern CompiledJob compiled_job;
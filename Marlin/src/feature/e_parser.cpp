@@ -42,6 +42,83 @@ bool EmergencyParser::killed_by_M112, // = false
   uint8_t EmergencyParser::M876_reason; // = 0
 #endif
 
+#if ENABLED(EMERGENCY_OVERRIDES)
+
+  #include "../module/planner.h"
+  #include "../module/motion.h"
+
+  bool EmergencyParser::valves_closed, // = false
+       EmergencyParser::override_flow;
+  uint16_t EmergencyParser::override_value, EmergencyParser::override_checksum;
+  uint8_t EmergencyParser::line_checksum;
+  int32_t EmergencyParser::line_number;
+  volatile bool EmergencyParser::override_pending[2];
+  volatile uint16_t EmergencyParser::override_pending_value[2];
+  volatile bool EmergencyParser::override_unclaimed[2];
+  volatile int32_t EmergencyParser::override_line[2];
+
+  // Called from the ISR when a whole M220 / M221 S<percent> line was read
+  void EmergencyParser::take_override() {
+    override_pending_value[override_flow] = override_value;
+    override_pending[override_flow] = true;
+    override_line[override_flow] = line_number;
+    override_unclaimed[override_flow] = true;
+  }
+
+  // From the main loop. M220 / M221 S<percent> take effect from the next planned move.
+  void EmergencyParser::apply_overrides() {
+    if (override_pending[0]) {
+      override_pending[0] = false;
+      feedrate_percentage = override_pending_value[0];
+    }
+    #if HAS_EXTRUDERS
+      if (override_pending[1]) {
+        override_pending[1] = false;
+        planner.set_flow(active_extruder, override_pending_value[1]);
+      }
+    #endif
+  }
+
+  /**
+   * Called as a serial line goes into the queue. Return 'true' if it is the line
+   * that was taken, or an older one already superseded by it. Copies the queue
+   * rejects (resends, duplicates) never get here, so only the accepted copy of a
+   * taken line claims it. Without line numbers the lines arrive in order.
+   */
+  bool EmergencyParser::claim_override(const char *cmd) {
+    if (!override_unclaimed[0] && !override_unclaimed[1]) return false;
+
+    while (*cmd == ' ') cmd++;
+    const int32_t n = (*cmd == 'N') ? strtol(cmd + 1, nullptr, 10) : -1;
+    const char * const m = strstr_P(cmd, PSTR("M22"));
+    if (!m || !WITHIN(m[3], '0', '1') || NUMERIC(m[4])) return false;
+    const bool flow = (m[3] == '1');
+
+    bool claimed = false;
+    CRITICAL_SECTION_START();
+    if (override_unclaimed[flow]) {
+      const int32_t taken = override_line[flow];
+      if (n >= 0 && taken >= 0 && n < taken)
+        claimed = true;                       // Superseded, the newer line is still to come
+      else {
+        claimed = (n == taken);               // A newer line means the taken one was dropped
+        override_unclaimed[flow] = false;
+      }
+    }
+    CRITICAL_SECTION_END();
+    return claimed;
+  }
+
+  // C000: Shut the dispensing valves and hold motion until R000
+  void EmergencyParser::close_valves() {
+    static constexpr pin_t pins[] = EMERGENCY_VALVE_PINS;
+    for (const pin_t pin : pins) WRITE(pin, LOW);
+    valves_closed = true;
+    quickpause_stepper();
+  }
+
+#endif
+
 // Global instance
 EmergencyParser emergency_parser;
 
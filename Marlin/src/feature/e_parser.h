@@ -34,9 +34,11 @@
 // External references
 extern bool wait_for_user, wait_for_heatup;
 
+// From motion.h, which cannot be included here
 #if ENABLED(REALTIME_REPORTING_COMMANDS)
-  // From motion.h, which cannot be included here
   void report_current_position_moving();
+#endif
+#if HAS_QUICK_PAUSE
   void quickpause_stepper();
   void quickresume_stepper();
 #endif
@@ -49,7 +51,7 @@ class EmergencyParser {
 
 public:
 
-  // Currently looking for: M108, M112, M410, M524, M876 S[0-9], S000, P000, R000
+  // Currently looking for: M108, M112, M220 S, M221 S, M410, M524, M876 S[0-9], S000, P000, R000, C000
   enum State : uint8_t {
     EP_RESET,
     EP_N,
@@ -66,9 +68,15 @@ public:
     #endif
     #if ENABLED(REALTIME_REPORTING_COMMANDS)
       EP_S, EP_S0, EP_S00, EP_GRBL_STATUS,
+    #endif
+    #if HAS_QUICK_PAUSE
       EP_R, EP_R0, EP_R00, EP_GRBL_RESUME,
       EP_P, EP_P0, EP_P00, EP_GRBL_PAUSE,
     #endif
+    #if ENABLED(EMERGENCY_OVERRIDES)
+      EP_M2, EP_M22, EP_M220, EP_M221, EP_M22XS, EP_M22XSN, EP_M22XSN_END, EP_M22XSN_CS,
+      EP_C, EP_C0, EP_C00, EP_VALVES_CLOSE,
+    #endif
     #if ENABLED(SOFT_RESET_VIA_SERIAL)
       EP_ctrl,
       EP_K, EP_KI, EP_KIL, EP_KILL,
@@ -87,23 +95,51 @@ public:
     static uint8_t M876_reason;
   #endif
 
+  #if ENABLED(EMERGENCY_OVERRIDES)
+    static bool valves_closed;    // Set by C000, cleared by R000
+    static bool override_flow;    // M221 (not M220) is being read
+    static uint16_t override_value, override_checksum;  // S<percent> and the checksum after '*'
+    static uint8_t line_checksum;                         // XOR of the line up to '*'
+    static int32_t line_number;                           // N of the line being read (-1 = none)
+    static volatile bool override_pending[2];             // [flow] Taken but not yet applied
+    static volatile uint16_t override_pending_value[2];
+    static volatile bool override_unclaimed[2];           // [flow] Taken but not yet matched to a queued line
+    static volatile int32_t override_line[2];             // [flow] N of the newest line taken (-1 = none)
+    static void take_override();
+    static void apply_overrides();
+    static bool claim_override(const char *cmd);
+    static void close_valves();
+  #endif
+
   EmergencyParser() { enable(); }
 
   FORCE_INLINE static void enable()  { enabled = true; }
   FORCE_INLINE static void disable() { enabled = false; }
+  FORCE_INLINE static bool is_enabled() { return enabled; }
 
   FORCE_INLINE static void update(State &state, const uint8_t c) {
+    #if ENABLED(EMERGENCY_OVERRIDES)
+      // Line number and checksum of M220 / M221 lines, as the queue will check them
+      if (state == EP_RESET) { line_checksum = 0; line_number = -1; }
+      if (state != EP_M22XSN_CS && c != '*') line_checksum ^= c;
+    #endif
+
     switch (state) {
       case EP_RESET:
         switch (c) {
           case ' ': case '\n': case '\r': break;
-          case 'N': state = EP_N; break;
+          case 'N': state = EP_N; TERN_(EMERGENCY_OVERRIDES, line_number = 0); break;
           case 'M': state = EP_M; break;
           #if ENABLED(REALTIME_REPORTING_COMMANDS)
             case 'S': state = EP_S; break;
+          #endif
+          #if HAS_QUICK_PAUSE
             case 'P': state = EP_P; break;
             case 'R': state = EP_R; break;
           #endif
+          #if ENABLED(EMERGENCY_OVERRIDES)
+            case 'C': state = EP_C; break;
+          #endif
           #if ENABLED(SOFT_RESET_VIA_SERIAL)
             case '^': state = EP_ctrl; break;
             case 'K': state = EP_K; break;
@@ -114,14 +150,19 @@ public:
 
       case EP_N:
         switch (c) {
-          case '0' ... '9':
+          case '0' ... '9': TERN_(EMERGENCY_OVERRIDES, line_number = line_number * 10 + c - '0'); break;
           case '-': case ' ':     break;
           case 'M': state = EP_M; break;
           #if ENABLED(REALTIME_REPORTING_COMMANDS)
             case 'S': state = EP_S; break;
+          #endif
+          #if HAS_QUICK_PAUSE
             case 'P': state = EP_P; break;
             case 'R': state = EP_R; break;
           #endif
+          #if ENABLED(EMERGENCY_OVERRIDES)
+            case 'C': state = EP_C; break;
+          #endif
           default: state = EP_IGNORE;
         }
         break;
@@ -130,7 +171,9 @@ public:
         case EP_S:   state = (c == '0') ? EP_S0          : EP_IGNORE; break;
         case EP_S0:  state = (c == '0') ? EP_S00         : EP_IGNORE; break;
         case EP_S00: state = (c == '0') ? EP_GRBL_STATUS : EP_IGNORE; break;
+      #endif
 
+      #if HAS_QUICK_PAUSE
         case EP_R:   state = (c == '0') ? EP_R0          : EP_IGNORE; break;
         case EP_R0:  state = (c == '0') ? EP_R00         : EP_IGNORE; break;
         case EP_R00: state = (c == '0') ? EP_GRBL_RESUME : EP_IGNORE; break;
@@ -140,6 +183,12 @@ public:
         case EP_P00: state = (c == '0') ? EP_GRBL_PAUSE  : EP_IGNORE; break;
       #endif
 
+      #if ENABLED(EMERGENCY_OVERRIDES)
+        case EP_C:   state = (c == '0') ? EP_C0           : EP_IGNORE; break;
+        case EP_C0:  state = (c == '0') ? EP_C00          : EP_IGNORE; break;
+        case EP_C00: state = (c == '0') ? EP_VALVES_CLOSE : EP_IGNORE; break;
+      #endif
+
       #if ENABLED(SOFT_RESET_VIA_SERIAL)
         case EP_ctrl: state = (c == 'X') ? EP_KILL : EP_IGNORE; break;
         case EP_K:    state = (c == 'I') ? EP_KI   : EP_IGNORE; break;
@@ -152,6 +201,9 @@ public:
           case ' ': break;
           case '1': state = EP_M1;     break;
           case '4': state = EP_M4;     break;
+          #if ENABLED(EMERGENCY_OVERRIDES)
+            case '2': state = EP_M2;   break;
+          #endif
           #if ENABLED(SDSUPPORT)
             case '5': state = EP_M5;   break;
           #endif
@@ -175,6 +227,88 @@ public:
       case EP_M4:  state = (c == '1') ? EP_M41  : EP_IGNORE; break;
       case EP_M41: state = (c == '0') ? EP_M410 : EP_IGNORE; break;
 
+      #if ENABLED(EMERGENCY_OVERRIDES)
+
+        case EP_M2:  state = (c == '2') ? EP_M22  : EP_IGNORE; break;
+        case EP_M22:
+          switch (c) {
+            case '0': state = EP_M220; override_flow = false; break;
+            case '1': state = EP_M221; override_flow = true;  break;
+            default: state = EP_IGNORE;
+          }
+          break;
+
+        // Only a plain S<percent> is taken. Other parameters are left to the queue.
+        case EP_M220:
+        case EP_M221:
+          switch (c) {
+            case ' ': break;
+            case 'S': state = EP_M22XS; break;
+            default: state = EP_IGNORE;
+          }
+          break;
+
+        case EP_M22XS:
+          switch (c) {
+            case ' ': break;
+            case '0' ... '9':
+              state = EP_M22XSN;
+              override_value = c - '0';
+              break;
+            default: state = EP_IGNORE;
+          }
+          break;
+
+        case EP_M22XSN:
+          switch (c) {
+            case '0' ... '9':
+              if (override_value < 1000) override_value = override_value * 10 + c - '0';
+              break;
+            case '.': case ' ': state = EP_M22XSN_END; break;
+            case '*': state = EP_M22XSN_CS; override_checksum = 0; break;
+            default:
+              if (ISEOL(c)) {
+                if (enabled) take_override();
+                state = EP_RESET;
+              }
+              else
+                state = EP_IGNORE;
+          }
+          break;
+
+        // Allow a fraction and a checksum, but not more parameters
+        case EP_M22XSN_END:
+          switch (c) {
+            case '0' ... '9': case ' ': break;
+            case '*': state = EP_M22XSN_CS; override_checksum = 0; break;
+            default:
+              if (ISEOL(c)) {
+                if (enabled) take_override();
+                state = EP_RESET;
+              }
+              else
+                state = EP_IGNORE;
+          }
+          break;
+
+        // A garbled line must not be applied, so take it only if the checksum matches
+        case EP_M22XSN_CS:
+          switch (c) {
+            case '0' ... '9':
+              if (override_checksum < 1000) override_checksum = override_checksum * 10 + c - '0';
+              break;
+            default:
+              if (ISEOL(c)) {
+                if (enabled && override_checksum == line_checksum) take_override();
+                state = EP_RESET;
+              }
+              else
+                state = EP_IGNORE;
+          }
+          break;
+
+      #endif
+
       #if ENABLED(SDSUPPORT)
         case EP_M5:  state = (c == '2') ? EP_M52  : EP_IGNORE; break;
         case EP_M52: state = (c == '4') ? EP_M524 : EP_IGNORE; break;
@@ -223,8 +357,16 @@ public:
             #endif
             #if ENABLED(REALTIME_REPORTING_COMMANDS)
               case EP_GRBL_STATUS: report_current_position_moving(); break;
+            #endif
+            #if HAS_QUICK_PAUSE
               case EP_GRBL_PAUSE: quickpause_stepper(); break;
-              case EP_GRBL_RESUME: quickresume_stepper(); break;
+              case EP_GRBL_RESUME:
+                TERN_(EMERGENCY_OVERRIDES, valves_closed = false);
+                quickresume_stepper();
+                break;
+            #endif
+            #if ENABLED(EMERGENCY_OVERRIDES)
+              case EP_VALVES_CLOSE: close_valves(); break;
             #endif
             #if ENABLED(SOFT_RESET_VIA_SERIAL)
               case EP_KILL: HAL_reboot(); break;
@@ -40,7 +40,7 @@
 HostUI hostui;
 
 void HostUI::action(FSTR_P const fstr, const bool eol) {
-  PORT_REDIRECT(SerialMask::All);
+  PORT_REDIRECT(SERIAL_CHANNEL_MASK(HOST));
   SERIAL_ECHOPGM("//action:");
   SERIAL_ECHOF(fstr);
   if (eol) SERIAL_EOL();
@@ -93,19 +93,19 @@ void HostUI::action(FSTR_P const fstr, const bool eol) {
   #endif
 
   void HostUI::notify(const char * const cstr) {
-    PORT_REDIRECT(SerialMask::All);
+    PORT_REDIRECT(SERIAL_CHANNEL_MASK(HOST));
     action(F("notification "), false);
     SERIAL_ECHOLN(cstr);
   }
 
   void HostUI::notify_P(PGM_P const pstr) {
-    PORT_REDIRECT(SerialMask::All);
+    PORT_REDIRECT(SERIAL_CHANNEL_MASK(HOST));
     action(F("notification "), false);
     SERIAL_ECHOLNPGM_P(pstr);
   }
 
   void HostUI::prompt(FSTR_P const ptype, const bool eol/*=true*/) {
-    PORT_REDIRECT(SerialMask::All);
+    PORT_REDIRECT(SERIAL_CHANNEL_MASK(HOST));
     action(F("prompt_"), false);
     SERIAL_ECHOF(ptype);
     if (eol) SERIAL_EOL();
@@ -113,7 +113,7 @@ void HostUI::action(FSTR_P const fstr, const bool eol) {
 
   void HostUI::prompt_plus(const bool pgm, FSTR_P const ptype, const char * const str, const char extra_char/*='\0'*/) {
     prompt(ptype, false);
-    PORT_REDIRECT(SerialMask::All);
+    PORT_REDIRECT(SERIAL_CHANNEL_MASK(HOST));
     SERIAL_CHAR(' ');
     if (pgm)
       SERIAL_ECHOPGM_P(str);
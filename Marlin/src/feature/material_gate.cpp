@@ -0,0 +1,175 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Material Gate
+ *
+ * The chamber, material and bed temperatures are checked against their
+ * configured windows at a fixed rate. The display is told once whenever the
+ * overall condition changes. With MATERIAL_GATE_HOLD the command queue stops
+ * in front of a dispensing start (while the machine keeps running) until all
+ * windows are satisfied, and a hold that times out or is cancelled aborts the job.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(MATERIAL_GATE)
+
+#include "material_gate.h"
+#include "../MarlinCore.h"
+#include "../gcode/gcode.h"
+#include "../module/temperature.h"
+
+#if ENABLED(MATERIAL_GATE_HOLD)
+  #include "../sd/cardreader.h"
+  #if ENABLED(HOST_ACTION_COMMANDS)
+    #include "host_actions.h"
+  #endif
+#endif
+
+MaterialGate material_gate;
+
+bool MaterialGate::ready, MaterialGate::published;
+millis_t MaterialGate::next_check_ms = 0;
+
+#if HAS_MATERIAL_GATE_CHAMBER
+  bool MaterialGate::chamber_ok;
+#endif
+#if HAS_MATERIAL_GATE_MATERIAL
+  bool MaterialGate::material_ok;
+#endif
+#if HAS_MATERIAL_GATE_BED
+  bool MaterialGate::bed_ok;
+#endif
+
+/**
+ * Check a reading against its window. Once a reading has left the window
+ * it must come back inside by MATERIAL_GATE_HYSTERESIS to count as OK again.
+ */
+static bool in_window(const bool was_ok, const celsius_float_t t, const celsius_float_t lo, const celsius_float_t hi) {
+  const celsius_float_t h = was_ok ? 0 : (MATERIAL_GATE_HYSTERESIS);
+  return t > lo + h && t < hi - h;
+}
+
+void MaterialGate::task() {
+  const millis_t ms = millis();
+  if (PENDING(ms, next_check_ms)) return;
+  next_check_ms = ms + (MATERIAL_GATE_INTERVAL);
+
+  bool ok = true;
+
+  #if HAS_MATERIAL_GATE_CHAMBER
+    chamber_ok = in_window(chamber_ok, thermalManager.degChamber(), MATERIAL_GATE_CHAMBER_MIN, MATERIAL_GATE_CHAMBER_MAX);
+    ok &= chamber_ok;
+  #endif
+  #if HAS_MATERIAL_GATE_MATERIAL
+    material_ok = in_window(material_ok, thermalManager.degHotend(0), MATERIAL_GATE_MATERIAL_MIN, MATERIAL_GATE_MATERIAL_MAX);
+    ok &= material_ok;
+  #endif
+  #if HAS_MATERIAL_GATE_BED
+    bed_ok = in_window(bed_ok, thermalManager.degBed(), MATERIAL_GATE_BED_MIN, MATERIAL_GATE_BED_MAX);
+    ok &= bed_ok;
+  #endif
+
+  if (ok != ready || !published) {
+    ready = ok;
+    publish();
+  }
+}
+
+// Tell the display whether material is too cold to dispense
+void MaterialGate::publish() {
+  published = true;
+  CHANNEL_REDIRECT(PANEL);
+  SERIAL_ECHOPGM("\xFF\xFF\xFF");
+  SERIAL_ECHOPGM("ilksayfa.can.val=", ready ? 0 : 1);
+  SERIAL_ECHOPGM("\xFF\xFF\xFF");
+}
+
+#if ENABLED(MATERIAL_GATE_HOLD)
+
+  millis_t MaterialGate::hold_expire_ms = 0;
+
+  // Match the dispensing starts, with or without a line number
+  static bool is_dispense(const char *cmd) {
+    while (*cmd == ' ') cmd++;
+    if (*cmd == 'N') {
+      do cmd++; while (NUMERIC(*cmd));
+      while (*cmd == ' ') cmd++;
+    }
+    if (*cmd++ != 'M' || !NUMERIC(*cmd)) return false;
+    switch (strtol(cmd, nullptr, 10)) {
+      case 5000: case 6161: case 6189: case 6191: return true;
+      default: return false;
+    }
+  }
+
+  void MaterialGate::end_hold() {
+    hold_expire_ms = 0;
+    wait_for_heatup = false;
+    TERN_(HOST_KEEPALIVE_FEATURE, gcode.busy_state = GcodeSuite::NOT_BUSY);
+  }
+
+  /**
+   * Called by the queue with the next command. A dispensing start while the
+   * windows aren't satisfied holds the queue (HOLD_WAIT) until they are, so
+   * idle() and the heaters keep running. A hold that times out or is cancelled
+   * with M108 aborts the job, and the queue drops the command (HOLD_DROP).
+   */
+  MaterialGate::HoldState MaterialGate::hold(const char * const cmd) {
+    if (!hold_expire_ms) {
+      if (ready || !is_dispense(cmd)) return HOLD_NONE;
+      SERIAL_ECHO_MSG("Waiting for material conditions");
+      hold_expire_ms = millis() + SEC_TO_MS(MATERIAL_GATE_TIMEOUT);
+      wait_for_heatup = true;
+      TERN_(HOST_KEEPALIVE_FEATURE, gcode.busy_state = GcodeSuite::PAUSED_FOR_USER);
+      return HOLD_WAIT;
+    }
+
+    if (ready) { end_hold(); return HOLD_NONE; }
+
+    const bool timed_out = ELAPSED(millis(), hold_expire_ms);
+    if (wait_for_heatup && !timed_out) return HOLD_WAIT;
+
+    end_hold();
+    if (timed_out)
+      SERIAL_ERROR_MSG("Dispensing timed out: material conditions not met");
+    else
+      SERIAL_ECHO_MSG("Dispensing cancelled: material conditions not met");
+
+    TERN_(SDSUPPORT, card.abortFilePrintSoon());
+    #ifdef ACTION_ON_CANCEL
+      hostui.cancel();
+    #endif
+    return HOLD_DROP;
+  }
+
+  // Commands injected outside the queue can't be held, so they are refused
+  bool MaterialGate::can_dispense() {
+    if (ready) return true;
+    SERIAL_ERROR_MSG("Dispensing refused: material conditions not met");
+    return false;
+  }
+
+#endif // MATERIAL_GATE_HOLD
+
+#endif // MATERIAL_GATE
@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * material_gate.h - Hold dispensing until chamber, material and bed are in range
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class MaterialGate {
+public:
+  static void task();                 // Evaluate the windows (called from Temperature::task)
+  static bool is_ready() { return ready; }
+
+  #if ENABLED(MATERIAL_GATE_HOLD)
+    enum HoldState : char { HOLD_NONE, HOLD_WAIT, HOLD_DROP };
+    static HoldState hold(const char * const cmd);  // Checked by the queue before each command
+    static bool can_dispense();                       // Refuse a dispensing start that wasn't held
+  #endif
+
+private:
+  static bool ready, published;
+  static millis_t next_check_ms;
+
+  #if HAS_MATERIAL_GATE_CHAMBER
+    static bool chamber_ok;
+  #endif
+  #if HAS_MATERIAL_GATE_MATERIAL
+    static bool material_ok;
+  #endif
+  #if HAS_MATERIAL_GATE_BED
+    static bool bed_ok;
+  #endif
+
+  #if ENABLED(MATERIAL_GATE_HOLD)
+    static millis_t hold_expire_ms;   // End of the current hold (0 = not holding)
+    static void end_hold();
+  #endif
+
+  static void publish();
+};
+
+extern MaterialGate material_gate;
@@ -0,0 +1,160 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Move Coalescing
+ *
+ * When a G1 is run the commands queued behind it are already in RAM. Each
+ * following G1 that continues along the same line, at the same feedrate and
+ * with the same extrusion per mm, is folded into the running move and retired
+ * from the queue with its "ok". The first command of any other kind stops the
+ * run, so every non-G1 command (such as a valve or dispense command) is a
+ * barrier that sees the machine exactly where it would have been.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(MOVE_COALESCING)
+
+#include "move_coalesce.h"
+#include "../gcode/gcode.h"
+#include "../gcode/queue.h"
+#include "../module/motion.h"
+#include "../sd/cardreader.h"
+
+#if ENABLED(PRINTCOUNTER)
+  #include "../module/printcounter.h"
+#endif
+
+#if ENABLED(CANCEL_OBJECTS)
+  #include "../feature/cancel_object.h"
+#endif
+
+MoveCoalescer move_coalescer;
+
+/**
+ * Check the raw text of a queued command for a plain G1 with only
+ * axis, E and F words, before going to the trouble of parsing it.
+ */
+static bool is_plain_G1(const char *p) {
+  auto uppercase = [](char c) {
+    if (TERN0(GCODE_CASE_INSENSITIVE, WITHIN(c, 'a', 'z')))
+      c += 'A' - 'a';
+    return c;
+  };
+
+  while (*p == ' ') ++p;
+  if (*p == 'N') do ++p; while (NUMERIC(*p) || *p == ' ');  // Skip the line number
+  if (uppercase(*p) != 'G') return false;
+  ++p;
+  while (*p == '0') ++p;
+  if (*p++ != '1' || NUMERIC(*p) || *p == '.') return false;
+  for (;; ++p) {
+    const char c = uppercase(*p);
+    if (c == '\0' || c == '*') return true;
+    if (!WITHIN(c, 'A', 'Z')) continue;
+    if (c == 'E' || c == 'F') continue;
+    bool axis = false;
+    LOOP_NUM_AXES(i) if (c == AXIS_CHAR(i)) { axis = true; break; }
+    if (!axis) return false;
+  }
+}
+
+// Length of the linear axis part of a move
+static float axis_length(const xyze_float_t &d) {
+  float sq = 0;
+  LOOP_NUM_AXES(i) sq += sq(d[i]);
+  return SQRT(sq);
+}
+
+void MoveCoalescer::extend() {
+  // Only G1 moves run from the command queue, and not while writing to SD
+  if (parser.codenum != 1 || TERN0(SDSUPPORT, card.flag.saving) || TERN0(CANCEL_OBJECTS, cancelable.skipping)) return;
+
+  GCodeQueue::RingBuffer &ring = queue.ring_buffer;
+  if (ring.length < 2 || !WITHIN(parser.command_ptr, ring.peek_next_command_string(), ring.peek_next_command_string() + MAX_CMD_SIZE - 1)) return;
+
+  const xyze_pos_t start = current_position;
+  const xyze_float_t first = destination - start;
+  const float first_len = axis_length(first);
+  if (first_len < 0.0001f || first_len > (MOVE_COALESCE_MAX_SEGMENT)) return;
+
+  const xyze_float_t dir = first * RECIPROCAL(first_len);
+  const float e_per_mm = first.e / first_len;
+  const feedRate_t fr_mm_s = feedrate_mm_s;
+  float total = first_len;
+  bool parsed = false;
+
+  while (ring.length >= 2) {
+    uint8_t n = ring.index_r;
+    ring.advance_pos(n, 0);
+    char * const next = ring.commands[n].buffer;
+    if (!is_plain_G1(next)) break;
+
+    parser.parse(next);
+    parsed = true;
+
+    // A feedrate change ends the run
+    if (parser.floatval('F') > 0 && !NEAR(parser.value_feedrate(), fr_mm_s)) break;
+
+    // Where the next move goes, measured from the end of this one
+    xyze_pos_t end = destination;
+    LOOP_NUM_AXES(i) if (parser.seenval(AXIS_CHAR(i))) {
+      const float v = parser.value_axis_units((AxisEnum)i);
+      end[i] = gcode.axis_is_relative(AxisEnum(i)) ? destination[i] + v : LOGICAL_TO_NATIVE(v, i);
+    }
+    #if HAS_EXTRUDERS
+      if (parser.seenval('E')) {
+        const float v = parser.value_axis_units(E_AXIS);
+        end.e = gcode.axis_is_relative(E_AXIS) ? destination.e + v : v;
+      }
+    #endif
+
+    const xyze_float_t seg = end - destination;
+    const float seg_len = axis_length(seg);
+    if (seg_len < 0.0001f || seg_len > (MOVE_COALESCE_MAX_SEGMENT)) break;
+    if (total + seg_len > (MOVE_COALESCE_MAX_LENGTH)) break;
+
+    // Extrusion per mm must carry on unchanged
+    if (ABS(seg.e / seg_len - e_per_mm) > (MOVE_COALESCE_E_RATIO) * ABS(e_per_mm)) break;
+
+    // The new end point must lie ahead, on (or very near) the first move's line
+    const xyze_float_t off = end - start;
+    float along = 0;
+    LOOP_NUM_AXES(i) along += off[i] * dir[i];
+    if (along <= total) break;
+    float dev = 0;
+    LOOP_NUM_AXES(i) dev += sq(off[i] - along * dir[i]);
+    if (dev > sq(MOVE_COALESCE_TOLERANCE)) break;
+
+    // Fold it into the running move
+    TERN_(PRINTCOUNTER, if (!DEBUGGING(DRYRUN)) print_job_timer.incFilamentUsed(seg.e));
+    destination = end;
+    total += seg_len;
+    ring.retire_next();
+  }
+
+  // Restore the parser state of the running command
+  if (parsed) parser.parse(ring.peek_next_command_string());
+}
+
+#endif // MOVE_COALESCING
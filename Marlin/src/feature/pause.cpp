@@ -607,13 +607,15 @@ void resume_print(const_float_t slow_load_length/*=0*/, const_float_t fast_load_
   DEBUG_SECTION(rp, "resume_print", true);
   DEBUG_ECHOLNPGM("... slowlen:", slow_load_length, " fastlen:", fast_load_length, " purgelen:", purge_length, " maxbeep:", max_beep_count, " targetTemp:", targetTemp DXC_SAY);
   endstops.filament(); // filament okuma 25.11.22
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
-  SERIAL_ECHOPGM("t10.txt=\"Resume process started...\"");
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
-
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
-  SERIAL_ECHOPGM("b9.aph=0");
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
+  {
+    CHANNEL_REDIRECT(PANEL);
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+    SERIAL_ECHOPGM("t10.txt=\"Resume process started...\"");
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+    SERIAL_ECHOPGM("b9.aph=0");
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+  }
 
 
 
@@ -711,12 +713,15 @@ void resume_print(const_float_t slow_load_length/*=0*/, const_float_t fast_load_
     if (did_pause_print) {
       --did_pause_print;
 
-      SERIAL_ECHOPGM("\xFF\xFF\xFF");
-      SERIAL_ECHOPGM("b7.aph=127");
-      SERIAL_ECHOPGM("\xFF\xFF\xFF");
-      SERIAL_ECHOPGM("\xFF\xFF\xFF");
-      SERIAL_ECHOPGM("t10.txt=\"Print continue...\"");
-      SERIAL_ECHOPGM("\xFF\xFF\xFF");
+      {
+        CHANNEL_REDIRECT(PANEL);
+        SERIAL_ECHOPGM("\xFF\xFF\xFF");
+        SERIAL_ECHOPGM("b7.aph=127");
+        SERIAL_ECHOPGM("\xFF\xFF\xFF");
+        SERIAL_ECHOPGM("\xFF\xFF\xFF");
+        SERIAL_ECHOPGM("t10.txt=\"Print continue...\"");
+        SERIAL_ECHOPGM("\xFF\xFF\xFF");
+      }
       card.startOrResumeFilePrinting();
       // Write PLR now to update the z axis value
       TERN_(POWER_LOSS_RECOVERY, if (recovery.enabled) recovery.save(true));
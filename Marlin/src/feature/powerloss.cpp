@@ -62,6 +62,10 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   #include "fwretract.h"
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  #include "../libs/crc16.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_POWER_LOSS_RECOVERY)
 #include "../core/debug_out.h"
 
@@ -78,6 +82,11 @@ PrintJobRecovery recovery;
   #define POWER_LOSS_RETRACT_LEN 0
 #endif
 
+#if HAS_PLR_VALVES
+  static constexpr pin_t valve_pins[] = EMERGENCY_VALVE_PINS;
+  static_assert(COUNT(valve_pins) <= 16, "Power-loss recovery saves at most 16 EMERGENCY_VALVE_PINS.");
+#endif
+
 /**
  * Clear the recovery info
  */
@@ -127,18 +136,29 @@ bool PrintJobRecovery::check() {
  */
 void PrintJobRecovery::purge() {
   init();
-  card.removeJobRecoveryFile();
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    // Keep the preallocated journal. An empty checkpoint marks it invalid.
+    if (journal_ready()) journal_checkpoint();
+  #else
+    card.removeJobRecoveryFile();
+  #endif
 }
 
 /**
  * Load the recovery data, if it exists
  */
 void PrintJobRecovery::load() {
-  if (exists()) {
-    open(true);
-    (void)file.read(&info, sizeof(info));
-    close();
-  }
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    init();
+    journal_block = 0;    // Locate the journal again in case the media changed
+    (void)journal_ready(true);
+  #else
+    if (exists()) {
+      open(true);
+      (void)file.read(&info, sizeof(info));
+      close();
+    }
+  #endif
   debug(F("Load"));
 }
 
@@ -148,6 +168,7 @@ void PrintJobRecovery::load() {
 void PrintJobRecovery::prepare() {
   card.getAbsFilenameInCWD(info.sd_filename);  // SD filename
   cmd_sdpos = 0;
+  TERN_(POWER_LOSS_JOURNAL, journal_block = 0); // Start the job with a checkpoint
 }
 
 /**
@@ -162,6 +183,11 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
     millis_t ms = millis();
   #endif
 
+  #if ENABLED(POWER_LOSS_JOURNAL) && POWER_LOSS_JOURNAL_INTERVAL > 0
+    static millis_t next_journal_ms; // = 0
+    const millis_t journal_ms = millis();
+  #endif
+
   #ifndef POWER_LOSS_MIN_Z_CHANGE
     #define POWER_LOSS_MIN_Z_CHANGE 0.05  // Vase-mode-friendly out of the box
   #endif
@@ -172,6 +198,9 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
       #if SAVE_INFO_INTERVAL_MS > 0       // Save if interval is elapsed
         || ELAPSED(ms, next_save_ms)
       #endif
+      #if ENABLED(POWER_LOSS_JOURNAL) && POWER_LOSS_JOURNAL_INTERVAL > 0
+        || ELAPSED(journal_ms, next_journal_ms) // Journal records are cheap
+      #endif
       // Save if Z is above the last-saved position by some minimum height
       || current_position.z > info.current_position.z + POWER_LOSS_MIN_Z_CHANGE
     #endif
@@ -180,6 +209,9 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
     #if SAVE_INFO_INTERVAL_MS > 0
       next_save_ms = ms + SAVE_INFO_INTERVAL_MS;
     #endif
+    #if ENABLED(POWER_LOSS_JOURNAL) && POWER_LOSS_JOURNAL_INTERVAL > 0
+      next_journal_ms = journal_ms + (POWER_LOSS_JOURNAL_INTERVAL);
+    #endif
 
     // Set Head and Foot to matching non-zero values
     if (!++info.valid_head) ++info.valid_head; // non-zero in sequence
@@ -217,6 +249,11 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
       COPY(info.fan_speed, thermalManager.fan_speed);
     #endif
 
+    #if HAS_PLR_VALVES
+      info.valves = 0;
+      LOOP_L_N(i, COUNT(valve_pins)) if (READ(valve_pins[i])) SBI(info.valves, i);
+    #endif
+
     #if HAS_LEVELING
       info.flag.leveling = planner.leveling_active;
       info.fade = TERN0(ENABLE_LEVELING_FADE_HEIGHT, planner.z_fade_height);
@@ -239,7 +276,8 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
     info.flag.dryrun = !!(marlin_debug_flags & MARLIN_DEBUG_DRYRUN);
     info.flag.allow_cold_extrusion = TERN0(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude);
 
-    write();
+    // A forced save writes a full checkpoint to the journal
+    TERN(POWER_LOSS_JOURNAL, journal_write(force), write());
   }
 }
 
@@ -340,6 +378,193 @@ void PrintJobRecovery::write() {
   if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
 }
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  /**
+   * The journal is a ring of POWER_LOSS_JOURNAL_BLOCKS blocks in a contiguous
+   * file. A checkpoint block holds the whole job_recovery_info_t. The blocks
+   * after it hold small delta records tagged with the checkpoint sequence.
+   * Each save is a single raw block write, so the FAT and directory entry are
+   * never touched while printing. Loading takes the newest valid checkpoint
+   * and replays the delta records that follow it.
+   */
+  #define PLR_CHECKPOINT_MAGIC 0x43524C50UL // "PLRC"
+  #define PLR_DELTA_MAGIC      0x44524C50UL // "PLRD"
+
+  typedef struct {
+    uint32_t magic, seq;
+  } journal_header_t;
+
+  typedef struct {
+    journal_header_t head;
+    uint16_t crc;
+    job_recovery_info_t info;
+  } journal_checkpoint_t;
+
+  typedef struct {
+    uint32_t sdpos;
+    xyze_pos_t current_position;
+    uint16_t feedrate;
+    millis_t print_job_elapsed;
+    #if HAS_FAN
+      uint8_t fan_speed[FAN_COUNT];
+    #endif
+    #if HAS_HOTEND
+      celsius_t target_temperature[HOTENDS];
+    #endif
+    #if HAS_HEATED_BED
+      celsius_t target_temperature_bed;
+    #endif
+    #if HAS_PLR_VALVES
+      uint16_t valves;
+    #endif
+    uint16_t crc;
+  } journal_delta_t;
+
+  static constexpr uint8_t journal_slots = (512 - sizeof(journal_header_t)) / sizeof(journal_delta_t);
+
+  static_assert(sizeof(journal_checkpoint_t) <= 512, "job_recovery_info_t is too large for a POWER_LOSS_JOURNAL checkpoint.");
+  static_assert(POWER_LOSS_JOURNAL_BLOCKS > 1 + ((POWER_LOSS_JOURNAL_CHECKPOINT) + journal_slots - 1) / journal_slots,
+                "POWER_LOSS_JOURNAL_BLOCKS is too small to hold POWER_LOSS_JOURNAL_CHECKPOINT records.");
+
+  static union {
+    uint8_t bytes[512];
+    journal_header_t head;
+    journal_checkpoint_t checkpoint;
+    struct { journal_header_t head; journal_delta_t delta[journal_slots]; } deltas;
+  } journal_buf;
+
+  uint32_t PrintJobRecovery::journal_block, // = 0
+           PrintJobRecovery::journal_seq;
+  uint16_t PrintJobRecovery::journal_index;
+  uint8_t PrintJobRecovery::journal_slot,
+          PrintJobRecovery::journal_records;
+
+  static uint16_t checkpoint_crc(const journal_checkpoint_t &c) {
+    uint16_t crc = 0xFFFF;
+    crc16(&crc, &c.head, sizeof(c.head));
+    crc16(&crc, &c.info, sizeof(c.info));
+    return crc;
+  }
+
+  // The sequence ties each record to its checkpoint
+  static uint16_t delta_crc(const journal_delta_t &d, const uint32_t seq) {
+    uint16_t crc = 0xFFFF;
+    crc16(&crc, &seq, sizeof(seq));
+    crc16(&crc, &d, offsetof(journal_delta_t, crc));
+    return crc;
+  }
+
+  /**
+   * Locate the journal on the media, if not done yet for this job.
+   * With 'apply' also load the newest state into info.
+   */
+  bool PrintJobRecovery::journal_ready(const bool apply/*=false*/) {
+    if (journal_block) return true;
+    if (card.jobRecoveryJournal(journal_block, POWER_LOSS_JOURNAL_BLOCKS) && journal_scan(apply)) return true;
+    journal_block = 0;
+    return false;
+  }
+
+  /**
+   * Find the newest checkpoint so later writes continue after it.
+   * With 'apply' load it and its delta records into info.
+   */
+  bool PrintJobRecovery::journal_scan(const bool apply) {
+    DiskIODriver * const driver = card.diskIODriver();
+
+    // The next write is a checkpoint in a new block
+    journal_records = POWER_LOSS_JOURNAL_CHECKPOINT;
+    journal_slot = journal_slots;
+    journal_seq = 0;
+
+    int16_t newest = -1;
+    for (uint16_t b = 0; b < POWER_LOSS_JOURNAL_BLOCKS; b++) {
+      if (!driver->readBlock(journal_block + b, journal_buf.bytes)) return false;
+      const journal_checkpoint_t &c = journal_buf.checkpoint;
+      if (c.head.magic == PLR_CHECKPOINT_MAGIC && (newest < 0 || c.head.seq > journal_seq) && c.crc == checkpoint_crc(c)) {
+        journal_seq = c.head.seq;
+        newest = b;
+      }
+    }
+    journal_index = newest < 0 ? (POWER_LOSS_JOURNAL_BLOCKS) - 1 : newest;
+
+    if (!apply || newest < 0) return true;
+
+    if (!driver->readBlock(journal_block + journal_index, journal_buf.bytes)) return false;
+    memcpy(&info, &journal_buf.checkpoint.info, sizeof(info));
+
+    // Replay the delta records that follow the checkpoint
+    uint16_t b = journal_index;
+    for (uint16_t n = (POWER_LOSS_JOURNAL_BLOCKS) - 1; n--;) {
+      b = (b + 1) % (POWER_LOSS_JOURNAL_BLOCKS);
+      if (!driver->readBlock(journal_block + b, journal_buf.bytes)) return false;
+      if (journal_buf.head.magic != PLR_DELTA_MAGIC || journal_buf.head.seq != journal_seq) break;
+      LOOP_L_N(i, journal_slots) {
+        const journal_delta_t &d = journal_buf.deltas.delta[i];
+        if (d.crc != delta_crc(d, journal_seq)) return true;
+        info.sdpos = d.sdpos;
+        info.current_position = d.current_position;
+        info.feedrate = d.feedrate;
+        info.print_job_elapsed = d.print_job_elapsed;
+        TERN_(HAS_FAN, COPY(info.fan_speed, d.fan_speed));
+        TERN_(HAS_HOTEND, COPY(info.target_temperature, d.target_temperature));
+        TERN_(HAS_HEATED_BED, info.target_temperature_bed = d.target_temperature_bed);
+        TERN_(HAS_PLR_VALVES, info.valves = d.valves);
+      }
+    }
+    return true;
+  }
+
+  // Write all of info to the next block
+  bool PrintJobRecovery::journal_checkpoint() {
+    journal_index = (journal_index + 1) % (POWER_LOSS_JOURNAL_BLOCKS);
+    memset(journal_buf.bytes, 0, sizeof(journal_buf));
+    journal_checkpoint_t &c = journal_buf.checkpoint;
+    c.head.magic = PLR_CHECKPOINT_MAGIC;
+    c.head.seq = ++journal_seq;
+    memcpy(&c.info, &info, sizeof(info));
+    c.crc = checkpoint_crc(c);
+    journal_records = 0;
+    journal_slot = journal_slots;   // Delta records start in the next block
+    return card.diskIODriver()->writeBlock(journal_block + journal_index, journal_buf.bytes);
+  }
+
+  // Add a delta record, rewriting only the current block
+  bool PrintJobRecovery::journal_append() {
+    if (journal_records >= POWER_LOSS_JOURNAL_CHECKPOINT) return journal_checkpoint();
+
+    if (journal_slot >= journal_slots) {
+      journal_index = (journal_index + 1) % (POWER_LOSS_JOURNAL_BLOCKS);
+      memset(journal_buf.bytes, 0, sizeof(journal_buf));
+      journal_buf.head.magic = PLR_DELTA_MAGIC;
+      journal_buf.head.seq = journal_seq;
+      journal_slot = 0;
+    }
+
+    journal_delta_t &d = journal_buf.deltas.delta[journal_slot++];
+    d.sdpos = info.sdpos;
+    d.current_position = info.current_position;
+    d.feedrate = info.feedrate;
+    d.print_job_elapsed = info.print_job_elapsed;
+    TERN_(HAS_FAN, COPY(d.fan_speed, info.fan_speed));
+    TERN_(HAS_HOTEND, COPY(d.target_temperature, info.target_temperature));
+    TERN_(HAS_HEATED_BED, d.target_temperature_bed = info.target_temperature_bed);
+    TERN_(HAS_PLR_VALVES, d.valves = info.valves);
+    d.crc = delta_crc(d, journal_seq);
+    journal_records++;
+
+    return card.diskIODriver()->writeBlock(journal_block + journal_index, journal_buf.bytes);
+  }
+
+  void PrintJobRecovery::journal_write(const bool full) {
+    debug(F("Journal"));
+    if (!journal_ready() || !(full ? journal_checkpoint() : journal_append()))
+      DEBUG_ECHOLNPGM("Power-loss journal write failed.");
+  }
+
+#endif // POWER_LOSS_JOURNAL
+
 /**
  * Resume the saved print job
  */
@@ -555,6 +780,11 @@ void PrintJobRecovery::resume() {
   sprintf_P(cmd, PSTR("G1Z%sF600"), dtostrf(z_print, 1, 3, str_1));
   gcode.process_subcommands_now(cmd);
 
+  // Reopen the dispensing valves that were open at the outage
+  #if HAS_PLR_VALVES
+    LOOP_L_N(i, COUNT(valve_pins)) if (TEST(info.valves, i)) OUT_WRITE(valve_pins[i], HIGH);
+  #endif
+
   // Restore the feedrate
   sprintf_P(cmd, PSTR("G1F%d"), info.feedrate);
   gcode.process_subcommands_now(cmd);
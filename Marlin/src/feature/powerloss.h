@@ -88,6 +88,10 @@ typedef struct {
     uint8_t fan_speed[FAN_COUNT];
   #endif
 
+  #if HAS_PLR_VALVES
+    uint16_t valves;              // Open dispensing valves, one bit per pin
+  #endif
+
   #if HAS_LEVELING
     float fade;
   #endif
@@ -215,6 +219,19 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static uint32_t journal_block,  //!< First block of the journal file (0 until located)
+                      journal_seq;    //!< Sequence number of the newest checkpoint
+      static uint16_t journal_index;  //!< Journal block written last
+      static uint8_t journal_slot,    //!< Next delta record in the current block
+                     journal_records; //!< Delta records since the checkpoint
+      static bool journal_ready(const bool apply=false);
+      static bool journal_scan(const bool apply);
+      static bool journal_checkpoint();
+      static bool journal_append();
+      static void journal_write(const bool full);
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const_float_t zraise);
     #endif
@@ -0,0 +1,250 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Predictive Heat-up
+ *
+ * Temperature commands (M104/M109, M140/M190, M141/M191) are noted as they
+ * enter the command queue, and the first lines of a media print are scanned
+ * when it starts. Each heater is then switched on early enough that, by the
+ * estimated time-to-target, all heaters reach temperature together instead
+ * of waiting for one another in sequence.
+ *
+ * A heater is only armed with the target of the next command that will set
+ * it, and targets are only ever raised. The real command still runs and
+ * does its own waiting, so this only moves the start of heating earlier.
+ *
+ * Look-ahead stops at G0-G3. A command is only armed once every move queued
+ * ahead of it has run, so temperature changes in the middle of a print are
+ * never applied ahead of the moves they belong after.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(PREDICTIVE_HEATUP)
+
+#include "predictive_heatup.h"
+#include "../module/temperature.h"
+
+#if ENABLED(SDSUPPORT)
+  #include "../sd/cardreader.h"
+#endif
+
+PredictiveHeatup predictive_heatup;
+
+PredictiveHeatup::slot_t PredictiveHeatup::slot[PH_SLOT_COUNT];
+uint32_t PredictiveHeatup::committed_seq, PredictiveHeatup::executed_seq, PredictiveHeatup::move_seq;
+uint8_t PredictiveHeatup::resets; // = 0
+millis_t PredictiveHeatup::next_task_ms = 0;
+
+#define PH_INTERVAL_MS  1000UL
+#define PH_MIN_RATE     0.01f   // (°C/s) Floor for the rate estimate
+#define PH_HEATING_DELTA    5   // (°C) Below-target distance at which heating is at full power
+
+celsius_float_t PredictiveHeatup::deg(const int8_t s) {
+  TERN_(HAS_HEATED_BED, if (s == PH_SLOT_BED) return thermalManager.degBed());
+  TERN_(HAS_HEATED_CHAMBER, if (s == PH_SLOT_CHAMBER) return thermalManager.degChamber());
+  return thermalManager.degHotend(s);
+}
+
+celsius_t PredictiveHeatup::deg_target(const int8_t s) {
+  TERN_(HAS_HEATED_BED, if (s == PH_SLOT_BED) return thermalManager.degTargetBed());
+  TERN_(HAS_HEATED_CHAMBER, if (s == PH_SLOT_CHAMBER) return thermalManager.degTargetChamber());
+  return thermalManager.degTargetHotend(s);
+}
+
+void PredictiveHeatup::set_target(const int8_t s, const celsius_t target) {
+  TERN_(HAS_HEATED_BED, if (s == PH_SLOT_BED) return thermalManager.setTargetBed(target));
+  TERN_(HAS_HEATED_CHAMBER, if (s == PH_SLOT_CHAMBER) return thermalManager.setTargetChamber(target));
+  TERN_(HAS_HOTEND, thermalManager.setTargetHotend(target, s));
+}
+
+// The configured (or modeled) heating rate, used until a better estimate is measured
+float PredictiveHeatup::default_rate(const int8_t s) {
+  TERN_(HAS_HEATED_BED, if (s == PH_SLOT_BED) return PREDICTIVE_HEATUP_RATE_BED);
+  TERN_(HAS_HEATED_CHAMBER, if (s == PH_SLOT_CHAMBER) return PREDICTIVE_HEATUP_RATE_CHAMBER);
+  #if ENABLED(MPCTEMP)
+    // Without losses the block heats at P / C
+    const MPC_t &mpc = thermalManager.temp_hotend[s].constants;
+    if (mpc.block_heat_capacity > 0) return mpc.heater_power / mpc.block_heat_capacity;
+  #endif
+  return PREDICTIVE_HEATUP_RATE_HOTEND;
+}
+
+void PredictiveHeatup::reset() {
+  committed_seq = executed_seq = move_seq = 0;
+  resets++;
+  LOOP_L_N(s, PH_SLOT_COUNT) { slot[s].seq = 0; slot[s].armed = false; }
+}
+
+/**
+ * Claim a heater for the command with the given sequence number.
+ * The earliest command still waiting in the queue owns the heater,
+ * so a later target never jumps ahead of one that comes first.
+ * 'after' is the sequence number of the last move queued before it.
+ */
+void PredictiveHeatup::note(const int8_t s, const celsius_t target, const uint32_t seq, const uint32_t after) {
+  slot_t &sl = slot[s];
+  if (sl.seq > executed_seq && sl.seq <= seq) return;
+  sl.seq = seq;
+  sl.after = after;
+  sl.target = target;
+  sl.armed = false;
+}
+
+// Get the integer value of a parameter, stopping at a comment or checksum
+static bool ph_param(const char *p, const char code, int16_t &val) {
+  for (; *p && *p != ';' && *p != '*' && *p != '('; p++)
+    if (*p == code && NUMERIC_SIGNED(p[1])) { val = atoi(p + 1); return true; }
+  return false;
+}
+
+/**
+ * Note the heater target of a temperature command, if any, and the
+ * sequence number of a G0-G3 move in 'moved'.
+ * Return 'true' if the line is a command (i.e., it will take a queue slot).
+ */
+bool PredictiveHeatup::scan_line(const char *cmd, const uint32_t seq, uint32_t &moved) {
+  while (*cmd == ' ') cmd++;
+  if (*cmd == 'N') {                                // Skip a line number
+    do cmd++; while (NUMERIC(*cmd));
+    while (*cmd == ' ') cmd++;
+  }
+  if (*cmd == '\0' || *cmd == ';') return false;
+  if (!NUMERIC(cmd[1])) return true;
+  if (*cmd == 'G') {
+    if (WITHIN(atoi(cmd + 1), 0, 3)) moved = seq;
+    return true;
+  }
+  if (*cmd != 'M') return true;
+
+  char *args;
+  const int code = strtol(cmd + 1, &args, 10);
+
+  int8_t s;
+  switch (code) {
+    #if HAS_HOTEND
+      case 104: case 109: {
+        int16_t t = 0;
+        if (TERN0(HAS_MULTI_HOTEND, ph_param(args, 'T', t) && !WITHIN(t, 0, HOTENDS - 1))) return true;
+        s = t;
+      } break;
+    #endif
+    #if HAS_HEATED_BED
+      case 140: case 190: s = PH_SLOT_BED; break;
+    #endif
+    #if HAS_HEATED_CHAMBER
+      case 141: case 191: s = PH_SLOT_CHAMBER; break;
+    #endif
+    default: return true;
+  }
+
+  // M109, M190 and M191 also accept R (wait for heating or cooling)
+  const bool can_wait = code == 109 || code == 190 || code == 191;
+  int16_t target;
+  if (ph_param(args, 'S', target) || (can_wait && ph_param(args, 'R', target)))
+    note(s, target, seq, moved);
+
+  return true;
+}
+
+void PredictiveHeatup::scan(const char *cmd) {
+  scan_line(cmd, ++committed_seq, move_seq);
+}
+
+#if ENABLED(SDSUPPORT)
+
+  /**
+   * Read ahead from the start of a fresh media print, numbering lines the
+   * same way they will be numbered when they reach the queue, then put the
+   * file position back where it was.
+   */
+  void PredictiveHeatup::scan_media() {
+    const uint32_t start = card.getIndex();
+    char line[MAX_CMD_SIZE];
+    uint8_t len = 0;
+    uint32_t seq = committed_seq, moved = move_seq;
+    for (uint16_t n = 0; n < (PREDICTIVE_HEATUP_MEDIA_SCAN) && !card.eof(); n++) {
+      const int16_t c = card.get();
+      if (c < 0) break;
+      if (ISEOL(c)) {
+        line[len] = '\0';
+        if (len && scan_line(line, seq + 1, moved)) seq++;
+        len = 0;
+      }
+      else if (len < sizeof(line) - 1)
+        line[len++] = c;
+    }
+    card.setIndex(start);
+  }
+
+#endif
+
+// Estimated seconds for a heater to go from its current temperature to the given target
+float PredictiveHeatup::seconds_to_target(const int8_t s, const celsius_t target) {
+  const float delta = target - deg(s);
+  return delta > 0 ? delta / (slot[s].rate ?: default_rate(s)) : 0;
+}
+
+void PredictiveHeatup::task() {
+  const millis_t ms = millis();
+  if (PENDING(ms, next_task_ms)) return;
+  next_task_ms = ms + PH_INTERVAL_MS;
+
+  // Refine the heating rate of every heater that is working toward a target
+  LOOP_L_N(s, PH_SLOT_COUNT) {
+    slot_t &sl = slot[s];
+    const celsius_float_t now = deg(s);
+    if (deg_target(s) - now > PH_HEATING_DELTA) {
+      const float sample = (now - sl.last) * (1000.0f / (PH_INTERVAL_MS));
+      if (sl.last && sample > 0) {
+        const float rate = sl.rate ?: default_rate(s);
+        sl.rate = _MAX(PH_MIN_RATE, rate + (sample - rate) * 0.25f);
+      }
+    }
+    sl.last = now;
+  }
+
+  // Release heaters whose owning command has already run
+  LOOP_L_N(s, PH_SLOT_COUNT) if (slot[s].seq && slot[s].seq <= executed_seq) slot[s].seq = 0;
+
+  // The longest wait among heaters already heating or ready to be armed
+  float longest = 0;
+  LOOP_L_N(s, PH_SLOT_COUNT) {
+    const slot_t &sl = slot[s];
+    NOLESS(longest, seconds_to_target(s, deg_target(s)));
+    if (ready(sl)) NOLESS(longest, seconds_to_target(s, sl.target));
+  }
+
+  // Arm each heater once its own heat-up time covers the remaining wait
+  LOOP_L_N(s, PH_SLOT_COUNT) {
+    slot_t &sl = slot[s];
+    if (!ready(sl)) continue;
+    if (sl.target <= deg_target(s)) { sl.armed = true; continue; }   // Never lower a target
+    if (seconds_to_target(s, sl.target) + (PREDICTIVE_HEATUP_MARGIN) >= longest) {
+      set_target(s, sl.target);
+      sl.armed = true;
+    }
+  }
+}
+
+#endif // PREDICTIVE_HEATUP
@@ -0,0 +1,80 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * predictive_heatup.h - Start heaters ahead of queued temperature commands
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class PredictiveHeatup {
+public:
+  static uint8_t resets;                      // Counts reset() calls
+  static void reset();                        // Forget all look-ahead targets (e.g., on queue clear)
+  static void scan(const char *cmd);          // Inspect a command as it enters the queue
+  static void executed() { executed_seq++; }  // A queued command was dispatched
+  static void task();                         // Arm heaters so they all reach their targets together
+
+  #if ENABLED(SDSUPPORT)
+    static void scan_media();                 // Look ahead into the start of the file being printed
+  #endif
+
+private:
+  // Indices for the heaters that can be armed ahead of time
+  enum SlotIndex : int8_t {
+    _PHS = -1
+    #define _PH_SLOT_E(N) ,PH_SLOT_E##N
+    REPEAT(HOTENDS, _PH_SLOT_E)
+    #undef _PH_SLOT_E
+    OPTARG(HAS_HEATED_BED, PH_SLOT_BED)
+    OPTARG(HAS_HEATED_CHAMBER, PH_SLOT_CHAMBER)
+    , PH_SLOT_COUNT
+  };
+
+  typedef struct {
+    uint32_t seq;           // Queue sequence of the command that owns this heater (0 = none)
+    uint32_t after;         // Queue sequence of the last move ahead of that command
+    celsius_t target;       // Target requested by that command
+    bool armed;             // Target already applied ahead of the command
+    float rate;             // Estimated heating rate (°C/s), refined while heating
+    celsius_float_t last;   // Temperature at the previous rate sample
+  } slot_t;
+
+  static slot_t slot[PH_SLOT_COUNT];
+  static uint32_t committed_seq, executed_seq, move_seq;
+  static millis_t next_task_ms;
+
+  static void note(const int8_t s, const celsius_t target, const uint32_t seq, const uint32_t after);
+  static bool scan_line(const char *cmd, const uint32_t seq, uint32_t &moved);
+
+  // Not armed yet, and no move is left to run ahead of the owning command
+  static bool ready(const slot_t &sl) { return sl.seq && !sl.armed && sl.after <= executed_seq; }
+  static float default_rate(const int8_t s);
+  static float seconds_to_target(const int8_t s, const celsius_t target);
+
+  static celsius_float_t deg(const int8_t s);
+  static celsius_t deg_target(const int8_t s);
+  static void set_target(const int8_t s, const celsius_t target);
+};
+
+extern PredictiveHeatup predictive_heatup;
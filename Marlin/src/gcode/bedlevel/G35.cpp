@@ -156,6 +156,7 @@ void GcodeSuite::G35() {
   }
 
   if (!err_break) {
+    CHANNEL_REDIRECT(PANEL);  // Adjustments are shown on the panel
     const float threads_factor[] = { 0.5, 0.7, 0.8 };
 
     // Calculate adjusts
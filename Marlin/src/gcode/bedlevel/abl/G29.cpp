@@ -134,6 +134,10 @@ public:
       bed_mesh_t z_values;
     #endif
 
+    #if ENABLED(ADAPTIVE_G29)
+      bool adaptive;
+    #endif
+
     #if ENABLED(AUTO_BED_LEVELING_LINEAR)
       int indexIntoAB[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
       float eqnAMatrix[(GRID_MAX_POINTS) * 3], // "A" matrix of the linear system of equations
@@ -148,6 +152,150 @@ public:
   constexpr int G29_State::abl_points;
 #endif
 
+#if BOTH(PROBE_FAST_PREDICTED, AUTO_BED_LEVELING_BILINEAR)
+
+  /**
+   * Predict the probe reading at the current mesh point from the stored mesh,
+   * if it has the same layout, or else from the last point probed.
+   */
+  static float predict_z(const G29_State &abl, const float last_z) {
+    if (bedlevel.grid_spacing == abl.gridSpacing && bedlevel.grid_start == abl.probe_position_lf) {
+      const float z = bedlevel.z_values[abl.meshCount.x][abl.meshCount.y];
+      if (!isnan(z)) return z - abl.Z_offset;
+    }
+    return last_z;
+  }
+
+#endif
+
+#if ENABLED(ADAPTIVE_G29)
+
+  // The coarse pass probes every other grid line plus the far edge
+  static bool is_coarse_line(const uint8_t i, const uint8_t n) { return !(i & 1) || i == n - 1; }
+
+  // Gather the coarse line indices for one axis. Return the count.
+  static uint8_t coarse_lines(uint8_t lines[], const uint8_t n) {
+    uint8_t count = 0;
+    LOOP_L_N(i, n) if (is_coarse_line(i, n)) lines[count++] = i;
+    return count;
+  }
+
+  /**
+   * Estimate how far a straight line between coarse points a and b strays from
+   * the bed, using the second divided difference over coarse points p < q < r.
+   * The error of linear interpolation over a span h is h^2 / 8 * |z''|.
+   */
+  static float span_error(const uint8_t p, const float zp, const uint8_t q, const float zq, const uint8_t r, const float zr, const uint8_t h) {
+    const float dd = ((zr - zq) / (r - q) - (zq - zp) / (q - p)) / (r - p);
+    return 0.25f * sq(h) * ABS(dd);
+  }
+
+  /**
+   * Probe the skipped points of every coarse cell whose estimated interpolation
+   * error exceeds ADAPTIVE_G29_TOLERANCE. Fill the rest from the cell corners.
+   * Return the last measured Z, or NAN if probing failed.
+   */
+  static float refine_grid(G29_State &abl, const bool faux, const ProbePtRaise raise_after) {
+    uint8_t xc[GRID_MAX_POINTS_X], yc[GRID_MAX_POINTS_Y];
+    const uint8_t cx = coarse_lines(xc, GRID_MAX_POINTS_X),
+                  cy = coarse_lines(yc, GRID_MAX_POINTS_Y);
+
+    #define ZC(I,J) abl.z_values[xc[I]][yc[J]]
+
+    // Interpolation error of the X span k along coarse row j
+    auto x_error = [&](const uint8_t k, const uint8_t j) {
+      const uint8_t h = xc[k + 1] - xc[k];
+      float e = 0;
+      if (k > 0)      NOLESS(e, span_error(xc[k - 1], ZC(k - 1, j), xc[k], ZC(k, j), xc[k + 1], ZC(k + 1, j), h));
+      if (k + 2 < cx) NOLESS(e, span_error(xc[k], ZC(k, j), xc[k + 1], ZC(k + 1, j), xc[k + 2], ZC(k + 2, j), h));
+      return e;
+    };
+
+    // Interpolation error of the Y span k along coarse column i
+    auto y_error = [&](const uint8_t i, const uint8_t k) {
+      const uint8_t h = yc[k + 1] - yc[k];
+      float e = 0;
+      if (k > 0)      NOLESS(e, span_error(yc[k - 1], ZC(i, k - 1), yc[k], ZC(i, k), yc[k + 1], ZC(i, k + 1), h));
+      if (k + 2 < cy) NOLESS(e, span_error(yc[k], ZC(i, k), yc[k + 1], ZC(i, k + 1), yc[k + 2], ZC(i, k + 2), h));
+      return e;
+    };
+
+    // Flag the cells that need their inner points probed
+    bool refine[GRID_MAX_CELLS_X][GRID_MAX_CELLS_Y] = { { false } };
+    LOOP_L_N(kx, cx - 1) LOOP_L_N(ky, cy - 1) {
+      if (xc[kx + 1] - xc[kx] < 2 && yc[ky + 1] - yc[ky] < 2) continue;
+      const float e = _MAX(x_error(kx, ky), x_error(kx, ky + 1), y_error(kx, ky), y_error(kx + 1, ky));
+      refine[kx][ky] = cx < 3 || cy < 3 || e > (ADAPTIVE_G29_TOLERANCE); // Too few lines to estimate curvature? Probe it all.
+    }
+
+    // Find the cell holding a grid point, preferring a flagged one
+    auto find_cell = [&](const uint8_t i, const uint8_t j, xy_uint8_t &cell) {
+      bool found = false;
+      LOOP_L_N(kx, cx - 1) if (WITHIN(i, xc[kx], xc[kx + 1]))
+        LOOP_L_N(ky, cy - 1) if (WITHIN(j, yc[ky], yc[ky + 1])) {
+          if (!found || refine[kx][ky]) { cell.set(kx, ky); found = true; }
+          if (refine[kx][ky]) return true;
+        }
+      return false;
+    };
+
+    // Bilinear interpolation between the corners of a coarse cell
+    auto interpolate = [&](const uint8_t i, const uint8_t j, const xy_uint8_t &cell) {
+      const float rx = float(i - xc[cell.x]) / (xc[cell.x + 1] - xc[cell.x]),
+                  ry = float(j - yc[cell.y]) / (yc[cell.y + 1] - yc[cell.y]),
+                  zf = ZC(cell.x, cell.y) + (ZC(cell.x, cell.y + 1) - ZC(cell.x, cell.y)) * ry,
+                  zb = ZC(cell.x + 1, cell.y) + (ZC(cell.x + 1, cell.y + 1) - ZC(cell.x + 1, cell.y)) * ry;
+      return zf + (zb - zf) * rx;
+    };
+
+    float measured_z = 0;
+    uint8_t probed = 0, filled = 0;
+    xy_uint8_t cell;
+
+    bool zig = true;
+    LOOP_L_N(j, GRID_MAX_POINTS_Y) {
+      for (uint8_t n = 0; n < GRID_MAX_POINTS_X; n++) {
+        const uint8_t i = zig ? n : (GRID_MAX_POINTS_X) - 1 - n;
+        float &z = abl.z_values[i][j];
+        if (!isnan(z) || !find_cell(i, j, cell)) continue;
+
+        abl.probePos.set(abl.probe_position_lf.x + abl.gridSpacing.x * i, abl.probe_position_lf.y + abl.gridSpacing.y * j);
+        if (abl.verbose_level) SERIAL_ECHOLNPGM("Refining mesh point ", i, ",", j, ".");
+
+        #if ENABLED(PROBE_FAST_PREDICTED)
+          if (!faux) probe.predicted_z = interpolate(i, j, cell) - abl.Z_offset;
+        #endif
+
+        measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
+        if (isnan(measured_z)) return NAN;
+
+        z = measured_z + abl.Z_offset;
+        TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(i, j, z));
+        probed++;
+        idle_no_sleep();
+      }
+      zig ^= true;
+    }
+
+    // Fill the remaining points by interpolating between the cell corners
+    LOOP_L_N(i, GRID_MAX_POINTS_X) LOOP_L_N(j, GRID_MAX_POINTS_Y) {
+      float &z = abl.z_values[i][j];
+      if (!isnan(z)) continue;
+      find_cell(i, j, cell);
+      z = interpolate(i, j, cell);
+      TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(i, j, z));
+      filled++;
+    }
+
+    #undef ZC
+
+    SERIAL_ECHOLNPGM("Adaptive G29: ", probed, " points refined, ", filled, " interpolated.");
+
+    return measured_z;
+  }
+
+#endif // ADAPTIVE_G29
+
 /**
  * G29: Detailed Z probe, probes the bed at 3 or more points.
  *      Will fail if the printer has not been homed with G28.
@@ -201,6 +349,11 @@ public:
  *
  *  Z  Supply an additional Z probe offset
  *
+ *  A  With ADAPTIVE_G29, probe a coarse grid and refine only where the bed
+ *     curves more than ADAPTIVE_G29_TOLERANCE. The other points are interpolated,
+ *     so a bump lying only on a skipped grid line is missed. Without A (or with A0)
+ *     every point is probed.
+ *
  * Extra parameters with PROBE_MANUALLY:
  *
  *  To do manual probing simply repeat G29 until the procedure is complete.
@@ -386,6 +539,7 @@ G29_TYPE GcodeSuite::G29() {
     #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
 
       abl.Z_offset = parser.linearval('Z');
+      TERN_(ADAPTIVE_G29, abl.adaptive = parser.boolval('A'));
 
     #endif
 
@@ -671,6 +825,11 @@ G29_TYPE GcodeSuite::G29() {
 
     #if ABL_USES_GRID
 
+      #if BOTH(PROBE_FAST_PREDICTED, AUTO_BED_LEVELING_BILINEAR)
+        float last_z = NAN; // Neighbour for the next prediction
+        probe.fast_offset = NAN; // Calibrate again on the first predicted point
+      #endif
+
       bool zig = PR_OUTER_SIZE & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
 
       // Outer loop is X with PROBE_Y_FIRST enabled
@@ -706,9 +865,21 @@ G29_TYPE GcodeSuite::G29() {
           // Avoid probing outside the round or hexagonal area
           if (TERN0(IS_KINEMATIC, !probe.can_reach(abl.probePos))) continue;
 
+          #if ENABLED(ADAPTIVE_G29)
+            // Leave the in-between points for the refinement pass
+            if (abl.adaptive && !(is_coarse_line(abl.meshCount.x, GRID_MAX_POINTS_X) && is_coarse_line(abl.meshCount.y, GRID_MAX_POINTS_Y))) {
+              abl.z_values[abl.meshCount.x][abl.meshCount.y] = NAN;
+              continue;
+            }
+          #endif
+
           if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing mesh point ", pt_index, "/", abl.abl_points, ".");
           TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_POINT), int(pt_index), int(abl.abl_points)));
 
+          #if BOTH(PROBE_FAST_PREDICTED, AUTO_BED_LEVELING_BILINEAR)
+            if (!faux) probe.predicted_z = predict_z(abl, last_z);
+          #endif
+
           abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
 
           if (isnan(abl.measured_z)) {
@@ -716,6 +887,8 @@ G29_TYPE GcodeSuite::G29() {
             break; // Breaks out of both loops
           }
 
+          TERN_(PROBE_FAST_PREDICTED, TERN_(AUTO_BED_LEVELING_BILINEAR, last_z = abl.measured_z));
+
           #if ENABLED(AUTO_BED_LEVELING_LINEAR)
 
             abl.mean += abl.measured_z;
@@ -740,6 +913,11 @@ G29_TYPE GcodeSuite::G29() {
         } // inner
       } // outer
 
+      #if ENABLED(ADAPTIVE_G29)
+        if (abl.adaptive && !isnan(abl.measured_z))
+          abl.measured_z = refine_grid(abl, faux, raise_after);
+      #endif
+
     #elif ENABLED(AUTO_BED_LEVELING_3POINT)
 
       // Probe at 3 arbitrary points
@@ -952,9 +1130,12 @@ G29_TYPE GcodeSuite::G29() {
   TERN_(HAS_MULTI_HOTEND, if (abl.tool_index != 0) tool_change(abl.tool_index));
 
   report_current_position();
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
-  SERIAL_ECHOPGM("x.val=1");
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
+  {
+    CHANNEL_REDIRECT(PANEL);
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+    SERIAL_ECHOPGM("x.val=1");
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+  }
 
   G29_RETURN(isnan(abl.measured_z), true);
 }
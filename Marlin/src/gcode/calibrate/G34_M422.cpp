@@ -295,18 +295,21 @@ void GcodeSuite::G34() {
             )
           );
         #endif
-      SERIAL_ECHOPGM("\xFF\xFF\xFF");
-      if (sayac == 0){SERIAL_ECHOPGM("t0.txt=\"Z2-Z1 : ");}
-      if (sayac == 1){SERIAL_ECHOPGM("t1.txt=\"Z2-Z1 : ");}
-      if (sayac == 2){SERIAL_ECHOPGM("t2.txt=\"Z2-Z1 : ");}
-      if (sayac == 3){SERIAL_ECHOPGM("t3.txt=\"Z2-Z1 : ");}
-      if (sayac == 4){SERIAL_ECHOPGM("t4.txt=\"Z2-Z1 : ");}
-      if (sayac == 5){SERIAL_ECHOPGM("t5.txt=\"Z2-Z1 : ");}
-      if (sayac == 6){SERIAL_ECHOPGM("t6.txt=\"Z2-Z1 : ");}
-      if (sayac == 7){SERIAL_ECHOPGM("t7.txt=\"Z2-Z1 : ");}
-      if (sayac == 8){SERIAL_ECHOPGM("t8.txt=\"Z2-Z1 : ");}
-      SERIAL_ECHO(ABS(z_measured[1] - z_measured[0]));
-      SERIAL_ECHOPGM("\"\xFF\xFF\xFF");
+      {
+        CHANNEL_REDIRECT(PANEL);
+        SERIAL_ECHOPGM("\xFF\xFF\xFF");
+        if (sayac == 0){SERIAL_ECHOPGM("t0.txt=\"Z2-Z1 : ");}
+        if (sayac == 1){SERIAL_ECHOPGM("t1.txt=\"Z2-Z1 : ");}
+        if (sayac == 2){SERIAL_ECHOPGM("t2.txt=\"Z2-Z1 : ");}
+        if (sayac == 3){SERIAL_ECHOPGM("t3.txt=\"Z2-Z1 : ");}
+        if (sayac == 4){SERIAL_ECHOPGM("t4.txt=\"Z2-Z1 : ");}
+        if (sayac == 5){SERIAL_ECHOPGM("t5.txt=\"Z2-Z1 : ");}
+        if (sayac == 6){SERIAL_ECHOPGM("t6.txt=\"Z2-Z1 : ");}
+        if (sayac == 7){SERIAL_ECHOPGM("t7.txt=\"Z2-Z1 : ");}
+        if (sayac == 8){SERIAL_ECHOPGM("t8.txt=\"Z2-Z1 : ");}
+        SERIAL_ECHO(ABS(z_measured[1] - z_measured[0]));
+        SERIAL_ECHOPGM("\"\xFF\xFF\xFF");
+      }
       sayac++;
           #if TRIPLE_Z
             , " Z3-Z2=", ABS(z_measured[2] - z_measured[1])
@@ -439,6 +442,7 @@ void GcodeSuite::G34() {
         SERIAL_ECHOLNPGM("G34 aborted.");
       else {
         SERIAL_ECHOLNPGM("Did ", iteration + (iteration != z_auto_align_iterations), " of ", z_auto_align_iterations);
+        CHANNEL_REDIRECT(PANEL);
         SERIAL_ECHOPGM("\xFF\xFF\xFF");
         SERIAL_ECHOPGM("t9.txt=\"Accuracy: ");
         SERIAL_ECHO(z_maxdiff);
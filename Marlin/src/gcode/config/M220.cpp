@@ -41,7 +41,8 @@ void GcodeSuite::M220() {
   if (parser.seen('B')) backup_feedrate_percentage = feedrate_percentage;
   if (parser.seen('R')) feedrate_percentage = backup_feedrate_percentage;
 
-  if (parser.seenval('S')) feedrate_percentage = parser.value_int();
+  if (parser.seenval('S') && !TERN0(EMERGENCY_OVERRIDES, override_applied("BR")))
+    feedrate_percentage = parser.value_int();
 
   if (!parser.seen_any()) {
     SERIAL_ECHOPGM("FR:", feedrate_percentage);
@@ -33,8 +33,10 @@ void GcodeSuite::M221() {
   const int8_t target_extruder = get_target_extruder_from_command();
   if (target_extruder < 0) return;
 
-  if (parser.seenval('S'))
-    planner.set_flow(target_extruder, parser.value_int());
+  if (parser.seenval('S')) {
+    if (!TERN0(EMERGENCY_OVERRIDES, override_applied("T")))
+      planner.set_flow(target_extruder, parser.value_int());
+  }
   else {
     SERIAL_ECHO_START();
     SERIAL_CHAR('E', '0' + target_extruder);
@@ -17,6 +17,7 @@ int PDD3= PD14;
 
 void GcodeSuite::M1073()
 {
+    CHANNEL_REDIRECT(PANEL);
     pinMode(PDD1, INPUT_PULLDOWN);
     if (digitalRead(PDD1)== HIGH){
         SERIAL_ECHOPGM("\xFF\xFF\xFF");
@@ -7,6 +7,11 @@
 #include "../queue.h"
 #include "../../feature/power.h"
 #include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MATERIAL_GATE_HOLD)
+  #include "../../feature/material_gate.h"
+#endif
+
 int MKW= PE11;
 int MH= PE8;
 
@@ -14,6 +19,9 @@ int MH= PE8;
 
 void GcodeSuite::M5000()
 {
+  #if ENABLED(MATERIAL_GATE_HOLD)
+    if (!material_gate.can_dispense()) return;
+  #endif
   Serial.begin(250000);
   pinMode(MKW, OUTPUT);
   pinMode(MH, OUTPUT);
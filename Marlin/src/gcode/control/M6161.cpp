@@ -7,6 +7,11 @@
 #include "../queue.h"
 #include "../../feature/power.h"
 #include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MATERIAL_GATE_HOLD)
+  #include "../../feature/material_gate.h"
+#endif
+
 int A= PC6; // neckog kart için yapıldı.
 int C1= PD11;
 int M1= PD10;
@@ -27,6 +32,9 @@ int m21=  PA6;
 
 void GcodeSuite::M6161()
 {
+  #if ENABLED(MATERIAL_GATE_HOLD)
+    if (!material_gate.can_dispense()) return;
+  #endif
   Serial.begin(250000);
   pinMode(A, OUTPUT);
   pinMode(C1, OUTPUT);
@@ -7,6 +7,11 @@
 #include "../queue.h"
 #include "../../feature/power.h"
 #include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MATERIAL_GATE_HOLD)
+  #include "../../feature/material_gate.h"
+#endif
+
 int AA= PC6;
 int CA1= PD11;
 int MA1= PD10;
@@ -27,6 +32,9 @@ int m22=  PA6;
 
 void GcodeSuite::M6189()
 {
+  #if ENABLED(MATERIAL_GATE_HOLD)
+    if (!material_gate.can_dispense()) return;
+  #endif
   Serial.begin(250000);
   pinMode(AA, OUTPUT);
   pinMode(CA1, OUTPUT);
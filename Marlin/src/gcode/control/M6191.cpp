@@ -7,6 +7,11 @@
 #include "../queue.h"
 #include "../../feature/power.h"
 #include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MATERIAL_GATE_HOLD)
+  #include "../../feature/material_gate.h"
+#endif
+
 int AAA= PC6;
 int CAA1= PD11;
 int MAA1= PD10;
@@ -27,6 +32,9 @@ int m23=  PA6;
 
 void GcodeSuite::M6191()
 {
+  #if ENABLED(MATERIAL_GATE_HOLD)
+    if (!material_gate.can_dispense()) return;
+  #endif
   Serial.begin(250000);
   pinMode(AAA, OUTPUT);
   pinMode(CAA1, OUTPUT);
@@ -68,14 +68,15 @@ void GcodeSuite::M125() {
 
   // Move to filament change position or given position
 
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
-  SERIAL_ECHOPGM("b7.aph=0");
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
-
-
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
-  SERIAL_ECHOPGM("t10.txt=\"Parking...\"");
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
+  {
+    CHANNEL_REDIRECT(PANEL);
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+    SERIAL_ECHOPGM("b7.aph=0");
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+    SERIAL_ECHOPGM("t10.txt=\"Parking...\"");
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+  }
   NUM_AXIS_CODE(
     if (parser.seenval('X')) park_point.x = RAW_X_POSITION(parser.linearval('X')),
     if (parser.seenval('Y')) park_point.y = RAW_Y_POSITION(parser.linearval('Y')),
@@ -105,12 +106,15 @@ void GcodeSuite::M125() {
   const bool show_lcd = TERN0(HAS_MARLINUI_MENU, parser.boolval('P'));
 
   if (pause_print(retract, park_point, show_lcd, 0)) {
-    SERIAL_ECHOPGM("\xFF\xFF\xFF");
-    SERIAL_ECHOPGM("b9.aph=127");
-    SERIAL_ECHOPGM("\xFF\xFF\xFF");
-    SERIAL_ECHOPGM("\xFF\xFF\xFF");
-    SERIAL_ECHOPGM("t10.txt=\"Paused...\"");
-    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+    {
+      CHANNEL_REDIRECT(PANEL);
+      SERIAL_ECHOPGM("\xFF\xFF\xFF");
+      SERIAL_ECHOPGM("b9.aph=127");
+      SERIAL_ECHOPGM("\xFF\xFF\xFF");
+      SERIAL_ECHOPGM("\xFF\xFF\xFF");
+      SERIAL_ECHOPGM("t10.txt=\"Paused...\"");
+      SERIAL_ECHOPGM("\xFF\xFF\xFF");
+    }
 
     if (ENABLED(EXTENSIBLE_UI) || BOTH(EMERGENCY_PARSER, HOST_PROMPT_SUPPORT) || !sd_printing || show_lcd) {
       wait_for_confirmation(false, 0);
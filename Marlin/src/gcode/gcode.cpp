@@ -69,6 +69,10 @@ GcodeSuite gcode;
   #include "../feature/fancheck.h"
 #endif
 
+#if ENABLED(EMERGENCY_OVERRIDES)
+  #include "../feature/e_parser.h"
+#endif
+
 #include "../MarlinCore.h" // for idle, kill
 
 // Inactivity shutdown
@@ -320,6 +324,70 @@ void GcodeSuite::dwell(millis_t time) {
 
 #endif // G29_RETRY_AND_RECOVER
 
+#if ENABLED(CUSTOM)
+
+  namespace {
+
+    // The smallest table size that gives every code a slot of its own
+    template<size_t N>
+    constexpr uint16_t perfect_hash_size(const GcodeSuite::CustomCode (&codes)[N]) {
+      for (uint16_t size = N; size < 16 * N; ++size) {
+        bool unique = true;
+        for (size_t i = 0; i < N && unique; ++i)
+          for (size_t j = i + 1; j < N && unique; ++j)
+            if (codes[i].codenum % size == codes[j].codenum % size) unique = false;
+        if (unique) return size;
+      }
+      return 0;
+    }
+
+    // Slots hold an index + 1 into the code list (0 = empty)
+    template<size_t N, uint16_t S>
+    struct PerfectHashTable {
+      uint8_t slot[S];
+      constexpr PerfectHashTable(const GcodeSuite::CustomCode (&codes)[N]) : slot{} {
+        for (size_t i = 0; i < N; ++i) slot[codes[i].codenum % S] = i + 1;
+      }
+    };
+
+  }
+
+  /**
+   * The custom (dispensing) M-codes have scattered four-digit numbers that
+   * would make a sparse switch. Find them instead with a perfect hash of the
+   * code number, built at compile time. (Descriptions are in gcode.h)
+   */
+  const GcodeSuite::CustomCode* GcodeSuite::custom_code(const uint16_t codenum) {
+    static constexpr CustomCode codes[] = {
+      { 6161, M6161, CUSTOM_OUTPUT },
+      { 6189, M6189, CUSTOM_OUTPUT },
+      { 6191, M6191, CUSTOM_OUTPUT },
+      { 1461, M1461, CUSTOM_OUTPUT },
+      { 1463, M1463, CUSTOM_OUTPUT },
+      { 1465, M1465, CUSTOM_OUTPUT },
+      { 5000, M5000, CUSTOM_OUTPUT },
+      { 2828, M2828, CUSTOM_OUTPUT },
+      { 3434, M3434, CUSTOM_OUTPUT },
+      { 1234, M1234, CUSTOM_OUTPUT },
+      { 2525, M2525, 0 },               // Filament monitoring
+      { 1181, M1181, CUSTOM_OUTPUT },   // Send to the WiFi module
+      { 1994, M1994, CUSTOM_OUTPUT },
+      { 1996, M1996, CUSTOM_OUTPUT },
+      { 1998, M1998, CUSTOM_OUTPUT },
+      { 1073, M1073, 0 },
+      { 1074, M1074, CUSTOM_OUTPUT },
+      { 2023, M2023, 0 }
+    };
+    static constexpr uint16_t size = perfect_hash_size(codes);
+    static_assert(size, "No perfect hash was found for the custom M-codes.");
+    static constexpr PerfectHashTable<COUNT(codes), size> table(codes);
+
+    const uint8_t i = table.slot[codenum % size];
+    return (i && codes[i - 1].codenum == codenum) ? &codes[i - 1] : nullptr;
+  }
+
+#endif // CUSTOM
+
 /**
  * Process the parsed command and dispatch it to its handler
  */
@@ -1097,33 +1165,21 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 3426: M3426(); break;                                // M3426: Read MCP3426 ADC (over i2c)
       #endif
 
-      default: parser.unknown_command_warning(); break;
-
-      #if ENABLED(CUSTOM) // Açıklamalar gcode.h'da
-        case 6161: M6161(); break;
-        case 6189: M6189(); break;
-        case 6191: M6191(); break;
-        case 1461: M1461(); break;
-        case 1463: M1463(); break;
-        case 1465: M1465(); break;
-        case 5000: M5000(); break;
-        //case 8181: M8181(); break;
-        //case 8080: M8080(); break;
-        case 2828: M2828(); break;
-        case 3434: M3434(); break;
-        case 1234: M1234(); break;
-        case 2525: M2525(); break;  //FİLAMENT İZLEME KOMUTU
-        case 1181: M1181(); break;
-        case 1994: M1994(); break;
-        case 1996: M1996(); break;
-        case 1998: M1998(); break;
-        case 1073: M1073(); break;
-        case 1074: M1074(); break;
-        case 2023: M2023(); break;
-                                         // M1181: wifi modülüne kod göndermek için eklendi.
-
+      default:
+        #if ENABLED(CUSTOM)
+          if (const CustomCode * const cc = custom_code(parser.codenum)) {
+            #if ENABLED(EMERGENCY_OVERRIDES)
+              // After C000 only the stop code may drive outputs, until R000
+              if (emergency_parser.valves_closed && (cc->flags & CUSTOM_OUTPUT) && parser.codenum != 2828) {
+                SERIAL_ECHO_MSG("Valves closed by C000. Send R000 to release.");
+                break;
+              }
+            #endif
+            cc->handler();
+            break;
+          }
         #endif
-
+        parser.unknown_command_warning(); break;
 
     }
     break;
@@ -1134,8 +1190,11 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
       case 'D': D(parser.codenum); break;                         // Dn: Debug codes
     #endif
 
-    #if ENABLED(REALTIME_REPORTING_COMMANDS)
-      case 'S': case 'P': case 'R': break;                        // Invalid S, P, R commands already filtered
+    #if HAS_QUICK_PAUSE
+      case 'P': case 'R':                                         // Invalid P, R commands already filtered
+      TERN_(REALTIME_REPORTING_COMMANDS, case 'S':)               // Invalid S commands already filtered
+      TERN_(EMERGENCY_OVERRIDES, case 'C':)                       // Invalid C commands already filtered
+        break;
     #endif
 
     default:
@@ -1154,6 +1213,22 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
   void M100_dump_routine(FSTR_P const title, const char * const start, const uintptr_t size);
 #endif
 
+#if ENABLED(EMERGENCY_OVERRIDES)
+
+  /**
+   * A plain "S<percent>" from a serial port may have been taken on arrival
+   * by the emergency parser. Applying it again here, behind the queue, could
+   * undo a newer override. The queue marks the lines that were taken (or were
+   * superseded by a newer one) as they arrive. Others are applied as usual.
+   */
+  bool GcodeSuite::override_applied(const char * const others) {
+    if (!queue.ring_buffer.peek_next_command().override_taken || parser.seen(others)) return false;
+    emergency_parser.apply_overrides();
+    return true;
+  }
+
+#endif
+
 /**
  * Process a single command and dispatch it to its handler
  * This is called from the main loop()
@@ -1174,8 +1249,11 @@ void GcodeSuite::process_next_command() {
     #endif
   }
 
-  // Parse the next command in the queue
-  parser.parse(command.buffer);
+  // Parse the next command in the queue, or load its saved parse
+  #if ENABLED(SD_COMPILED_JOBS)
+    if (command.parsed) parser.load(command.buffer); else
+  #endif
+      parser.parse(command.buffer);
   process_parsed_command();
 }
 
@@ -1232,7 +1310,7 @@ void GcodeSuite::process_subcommands_now(char * gcode) {
     static millis_t next_busy_signal_ms = 0;
     if (!autoreport_paused && host_keepalive_interval && busy_state != NOT_BUSY) {
       if (PENDING(ms, next_busy_signal_ms)) return;
-      PORT_REDIRECT(SerialMask::All);
+      PORT_REDIRECT(SERIAL_CHANNEL_MASK(HOST));
       switch (busy_state) {
         case IN_HANDLER:
         case IN_PROCESS:
@@ -427,6 +427,18 @@ public:
   static void process_parsed_command(const bool no_ok=false);
   static void process_next_command();
 
+  #if ENABLED(CUSTOM)
+    // Properties of the custom M-codes, for the dispatcher
+    enum CustomCodeFlag : uint8_t {
+      CUSTOM_OUTPUT = _BV(0)    // Drives valves, pumps or relays
+    };
+    struct CustomCode {
+      uint16_t codenum;
+      void (*handler)();
+      uint8_t flags;
+    };
+  #endif
+
   // Execute G-code in-place, preserving current G-code parameters
   static void process_subcommands_now(FSTR_P fgcode);
   static void process_subcommands_now(char * gcode);
@@ -879,6 +891,10 @@ private:
     static void M221();
   #endif
 
+  #if ENABLED(EMERGENCY_OVERRIDES)
+    static bool override_applied(const char * const others);
+  #endif
+
   #if ENABLED(DIRECT_PIN_CONTROL)
     static void M226();
   #endif
@@ -1271,6 +1287,10 @@ private:
   static void M1073();
   static void M1074();
 
+  #if ENABLED(CUSTOM)
+    static const CustomCode* custom_code(const uint16_t codenum);
+  #endif
+
 
 };
 
@@ -36,6 +36,7 @@ int x = 0;
 int y = 0;
 int z = 0;
 void GcodeSuite::M118() {
+  CHANNEL_REDIRECT(PANEL);
 
   char *p = parser.string_arg;
 
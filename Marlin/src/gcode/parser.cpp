@@ -27,6 +27,7 @@
 #include "parser.h"
 
 #include "../MarlinCore.h"
+#include "../libs/decimal.h"
 
 // Must be declared for allocation and to satisfy the linker
 // Zero values need no initialization.
@@ -62,6 +63,11 @@ uint16_t GCodeParser::codenum;
   // Optimized Parameters
   uint32_t GCodeParser::codebits;  // found bits
   uint8_t GCodeParser::param[26];  // parameter offsets from command_ptr
+  #if ENABLED(SD_COMPILED_JOBS)
+    uint32_t GCodeParser::fixedbits; // pre-converted bits
+    int32_t GCodeParser::fixed[26],  // pre-converted values
+           *GCodeParser::value_fixed;
+  #endif
 #else
   char *GCodeParser::command_args; // start of parameters
 #endif
@@ -82,6 +88,7 @@ void GCodeParser::reset() {
   TERN_(USE_GCODE_SUBCODES, subcode = 0); // No command sub-code
   #if ENABLED(FASTER_GCODE_PARSER)
     codebits = 0;                       // No codes yet
+    TERN_(SD_COMPILED_JOBS, fixedbits = 0); // No pre-converted values
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
   #endif
 }
@@ -152,10 +159,11 @@ void GCodeParser::parse(char *p) {
   /**
    * Screen for good command letters.
    * With Realtime Reporting, commands S000, P000, and R000 are allowed.
+   * With Emergency Overrides, commands P000, R000, and C000 are allowed.
    */
-  #if ENABLED(REALTIME_REPORTING_COMMANDS)
+  #if HAS_QUICK_PAUSE
     switch (letter) {
-      case 'P': case 'R' ... 'S': {
+      case 'P': case 'R': TERN_(REALTIME_REPORTING_COMMANDS, case 'S':) TERN_(EMERGENCY_OVERRIDES, case 'C':) {
         uint8_t digits = 0;
         char *a = p;
         while (*a++ == '0') digits++; // Count up '0' characters
@@ -383,6 +391,152 @@ void GCodeParser::parse(char *p) {
 
 #endif // CNC_COORDINATE_SYSTEMS
 
+// strtof with 'E' and 'X' removed to prevent scientific and hex interpretation
+static float strtof_value(char * const value) {
+  char *e = value;
+  for (;;) {
+    const char c = *e;
+    if (c == '\0' || c == ' ') break;
+    if (c == 'E' || c == 'e' || c == 'X' || c == 'x') {
+      *e = '\0';
+      const float ret = strtof(value, nullptr);
+      *e = c;
+      return ret;
+    }
+    ++e;
+  }
+  return strtof(value, nullptr);
+}
+
+/**
+ * Get the current value as a float.
+ * Plain decimals are converted directly. Other forms fall back to strtof.
+ */
+float GCodeParser::value_float() {
+  if (!value_ptr) return 0;
+
+  #if ENABLED(SD_COMPILED_JOBS)
+    if (value_fixed) return *value_fixed / 1000.0f;
+  #endif
+
+  float f;
+  return decimal_to_float(value_ptr, f) ? f : strtof_value(value_ptr);
+}
+
+#if ENABLED(SD_COMPILED_JOBS)
+
+  /**
+   * The parse state saved after the text of a line. The offsets of the
+   * parameters that were seen follow, then the pre-converted values.
+   */
+  struct ParsedLine {
+    uint8_t command,      // command_ptr offset into the text
+            string_arg,   // string_arg offset from command_ptr, or 0 for none
+            subcode;
+    char letter;
+    uint16_t codenum;
+    uint32_t codebits, fixedbits;
+  } __attribute__((packed));
+
+  /**
+   * Save the state of the last parse(text). A value is stored pre-converted
+   * when its thousandths divided by 1000 give exactly the float the text
+   * gives, so value_float() returns the same result either way.
+   * Return the number of bytes written, or 0 if the state can't be saved.
+   */
+  uint8_t GCodeParser::save(char * const text, uint8_t * const out, const uint8_t room) {
+    const uint8_t len = strlen(text);
+    if (!command_ptr || command_ptr < text || command_ptr > text + len) return 0;
+
+    ParsedLine pl;
+    pl.command = command_ptr - text;
+    pl.string_arg = string_arg ? string_arg - command_ptr : 0;
+    if (string_arg && (string_arg < command_ptr || string_arg > text + len)) return 0;
+    pl.subcode = TERN0(USE_GCODE_SUBCODES, subcode);
+    pl.letter = command_letter;
+    pl.codenum = codenum;
+    pl.codebits = codebits;
+    pl.fixedbits = 0;
+
+    uint8_t n = sizeof(pl);
+    if (n > room) return 0;
+
+    // Parameter offsets, which must all fall within the text
+    LOOP_L_N(i, COUNT(param)) if (TEST32(codebits, i)) {
+      if (n >= room || pl.command + param[i] > len) return 0;
+      out[n++] = param[i];
+    }
+
+    // Values that convert exactly from thousandths
+    LOOP_L_N(i, COUNT(param)) {
+      if (!seen('A' + i) || !has_value()) continue;
+      const float f = value_float();
+      if (!WITHIN(f, -16777.0f, 16777.0f)) continue;
+      const int32_t v = LROUND(f * 1000.0f);
+      const float g = v / 1000.0f;
+      if (memcmp(&f, &g, sizeof(f))) continue;
+      if (n + sizeof(v) > room) return 0;
+      memcpy(&out[n], &v, sizeof(v));
+      n += sizeof(v);
+      SBI32(pl.fixedbits, i);
+    }
+
+    memcpy(out, &pl, sizeof(pl));
+    return n;
+  }
+
+  /**
+   * Parse a line ahead of its turn and save its state after it, in a buffer
+   * of the given size. Return the size of text and state, or 0 if the state
+   * can't be saved. This runs while the queue is filled, which idle() can do
+   * in the middle of another command, so that command's parse state is put
+   * back afterward.
+   */
+  uint8_t GCodeParser::compile(char * const text, const uint8_t size) {
+    #define _KEEP(V) const auto kept_##V = V
+    #define _PUT_BACK(V) V = kept_##V
+    _KEEP(value_ptr); _KEEP(value_fixed); _KEEP(codebits); _KEEP(fixedbits);
+    _KEEP(command_ptr); _KEEP(string_arg); _KEEP(command_letter); _KEEP(codenum);
+    TERN_(USE_GCODE_SUBCODES, _KEEP(subcode));
+    uint8_t kept_param[COUNT(param)];
+    int32_t kept_fixed[COUNT(fixed)];
+    memcpy(kept_param, param, sizeof(param));
+    memcpy(kept_fixed, fixed, sizeof(fixed));
+
+    parse(text);
+    const uint8_t len = strlen(text) + 1,
+                  n = save(text, (uint8_t*)&text[len], size - len);
+
+    _PUT_BACK(value_ptr); _PUT_BACK(value_fixed); _PUT_BACK(codebits); _PUT_BACK(fixedbits);
+    _PUT_BACK(command_ptr); _PUT_BACK(string_arg); _PUT_BACK(command_letter); _PUT_BACK(codenum);
+    TERN_(USE_GCODE_SUBCODES, _PUT_BACK(subcode));
+    memcpy(param, kept_param, sizeof(param));
+    memcpy(fixed, kept_fixed, sizeof(fixed));
+    #undef _KEEP
+    #undef _PUT_BACK
+
+    return n ? len + n : 0;
+  }
+
+  void GCodeParser::load(char * const text) {
+    const uint8_t *in = (uint8_t*)text + strlen(text) + 1;
+    ParsedLine pl;
+    memcpy(&pl, in, sizeof(pl));
+    in += sizeof(pl);
+
+    command_ptr = text + pl.command;
+    string_arg = pl.string_arg ? command_ptr + pl.string_arg : nullptr;
+    command_letter = pl.letter;
+    codenum = pl.codenum;
+    TERN_(USE_GCODE_SUBCODES, subcode = pl.subcode);
+    codebits = pl.codebits;
+    fixedbits = pl.fixedbits;
+    LOOP_L_N(i, COUNT(param)) if (TEST32(codebits, i)) param[i] = *in++;
+    LOOP_L_N(i, COUNT(param)) if (TEST32(fixedbits, i)) { memcpy(&fixed[i], in, sizeof(fixed[i])); in += sizeof(fixed[i]); }
+  }
+
+#endif // SD_COMPILED_JOBS
+
 void GCodeParser::unknown_command_warning() {
   SERIAL_ECHO_MSG(STR_UNKNOWN_COMMAND, command_ptr, "\"");
 }
@@ -62,6 +62,11 @@ private:
   #if ENABLED(FASTER_GCODE_PARSER)
     static uint32_t codebits;       // Parameters pre-scanned
     static uint8_t param[26];       // For A-Z, offsets into command args
+    #if ENABLED(SD_COMPILED_JOBS)
+      static uint32_t fixedbits;    // Parameters with a pre-converted value
+      static int32_t fixed[26];     // For A-Z, values in thousandths
+      static int32_t *value_fixed;  // Set by seen, used by value_float
+    #endif
   #else
     static char *command_args;      // Args start here, for slow scan
   #endif
@@ -153,6 +158,7 @@ public:
         }
         else
           value_ptr = nullptr;
+        TERN_(SD_COMPILED_JOBS, value_fixed = TEST32(fixedbits, ind) ? &fixed[ind] : nullptr);
       }
       return b;
     }
@@ -242,6 +248,15 @@ public:
     static bool chain();
   #endif
 
+  #if ENABLED(SD_COMPILED_JOBS)
+    // Append the state of the last parse after its text, for load() to restore later
+    static uint8_t save(char * const text, uint8_t * const out, const uint8_t room);
+    // Parse a line and save its state as above, leaving the current parse untouched
+    static uint8_t compile(char * const text, const uint8_t size);
+    // Populate all fields from a line stored by save(), skipping the parse
+    static void load(char * const text);
+  #endif
+
   // Test whether the parsed command matches the input
   static bool is_command(const char ltr, const uint16_t num) { return command_letter == ltr && codenum == num; }
 
@@ -254,23 +269,8 @@ public:
   // The value as a string
   static char* value_string() { return value_ptr; }
 
-  // Float removes 'E' to prevent scientific notation interpretation
-  static float value_float() {
-    if (!value_ptr) return 0;
-    char *e = value_ptr;
-    for (;;) {
-      const char c = *e;
-      if (c == '\0' || c == ' ') break;
-      if (c == 'E' || c == 'e' || c == 'X' || c == 'x') {
-        *e = '\0';
-        const float ret = strtof(value_ptr, nullptr);
-        *e = c;
-        return ret;
-      }
-      ++e;
-    }
-    return strtof(value_ptr, nullptr);
-  }
+  // Float ignores 'E' to prevent scientific notation interpretation
+  static float value_float();
 
   // Code value as a long or ulong
   static int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
@@ -57,12 +57,31 @@ GCodeQueue queue;
   #include "../feature/repeat.h"
 #endif
 
+#if ENABLED(MATERIAL_GATE_HOLD)
+  #include "../feature/material_gate.h"
+#endif
+
+#if ENABLED(EMERGENCY_OVERRIDES)
+  #include "../feature/e_parser.h"
+#endif
+
 // Frequently used G-code strings
 PGMSTR(G28_STR, "G28");
 
 GCodeQueue::SerialState GCodeQueue::serial_state[NUM_SERIAL] = { 0 };
 GCodeQueue::RingBuffer GCodeQueue::ring_buffer = { 0 };
 
+// Line buffers for the ring slots plus one spare per serial port
+static char command_pool[BUFSIZE + NUM_SERIAL][MAX_CMD_SIZE];
+
+GCodeQueue::GCodeQueue() {
+  LOOP_L_N(i, BUFSIZE) ring_buffer.commands[i].buffer = command_pool[i];
+  LOOP_L_N(p, NUM_SERIAL) {
+    serial_state[p].line_buffer = command_pool[BUFSIZE + p];
+    serial_state[p].start_line();
+  }
+}
+
 #if NO_TIMEOUTS > 0
   static millis_t last_command_time = 0;
 #endif
@@ -103,8 +122,11 @@ void GCodeQueue::RingBuffer::commit_command(bool skip_ok
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
   commands[index_w].skip_ok = skip_ok;
+  TERN_(SD_COMPILED_JOBS, commands[index_w].parsed = false);
   TERN_(HAS_MULTI_SERIAL, commands[index_w].port = serial_ind);
+  TERN_(EMERGENCY_OVERRIDES, commands[index_w].override_taken = !skip_ok && emergency_parser.claim_override(commands[index_w].buffer));
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
+  TERN_(PREDICTIVE_HEATUP, predictive_heatup.scan(commands[index_w].buffer));
   advance_pos(index_w, 1);
 }
 
@@ -122,6 +144,19 @@ bool GCodeQueue::RingBuffer::enqueue(const char *cmd, bool skip_ok/*=true*/
   return true;
 }
 
+/**
+ * Swap a completed line into the main command buffer without copying it.
+ * The write slot's old buffer is handed back to become the new accumulator.
+ */
+void GCodeQueue::RingBuffer::commit_line(char* &line, bool skip_ok
+  OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
+) {
+  char * const spare = commands[index_w].buffer;
+  commands[index_w].buffer = line;
+  line = spare;
+  commit_command(skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind));
+}
+
 /**
  * Enqueue with Serial Echo
  * Return true if the command was consumed
@@ -266,6 +301,32 @@ void GCodeQueue::RingBuffer::ok_to_send() {
   SERIAL_EOL();
 }
 
+#if ENABLED(MOVE_COALESCING)
+
+  /**
+   * Retire the command queued after the running one, which has been merged
+   * into it, and send its "ok". The running command moves up into its slot.
+   */
+  void GCodeQueue::RingBuffer::retire_next() {
+    uint8_t n = index_r;
+    advance_pos(n, 0);
+    const CommandLine running = commands[index_r];
+    commands[index_r] = commands[n];
+    commands[n] = running;
+    #if ENABLED(POWER_LOSS_RECOVERY)
+      const uint32_t sdpos = recovery.sdpos[index_r];
+      recovery.sdpos[index_r] = recovery.sdpos[n];
+      recovery.sdpos[n] = sdpos;
+      recovery.queue_index_r = n;
+    #endif
+    ok_to_send();
+    // A command that cleared the queue also restarted the sequence numbers
+  TERN_(PREDICTIVE_HEATUP, if (heatup_resets == predictive_heatup.resets) predictive_heatup.executed());
+    advance_pos(index_r, -1);
+  }
+
+#endif
+
 /**
  * Send a "Resend: nnn" message to the host to
  * indicate that a command needs to be re-sent.
@@ -309,7 +370,7 @@ void GCodeQueue::gcode_line_error(FSTR_P const ferr, const serial_index_t serial
   SERIAL_ECHOLNF(ferr, serial_state[serial_ind.index].last_N);
   while (read_serial(serial_ind) != -1) { /* nada */ } // Clear out the RX buffer. Why don't use flush here ?
   flush_and_request_resend(serial_ind);
-  serial_state[serial_ind.index].count = 0;
+  serial_state[serial_ind.index].start_line();
 }
 
 FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", but not "M290", etc
@@ -323,7 +384,7 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_PAREN  3
 #define PS_ESC    4
 
-inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline void process_stream_char(const char c, uint8_t &sis, char * const buff, int &ind) {
 
   if (sis == PS_EOL) return;    // EOL comment or overflow
 
@@ -379,7 +440,7 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
  */
-inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline bool process_line_done(uint8_t &sis, char * const buff, int &ind) {
   sis = PS_NORMAL;                    // "Normal" Serial Input State
   buff[ind] = '\0';                   // Of course, I'm a Terminator.
   const bool is_empty = (ind == 0);   // An empty line?
@@ -390,6 +451,35 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return is_empty;                    // Inform the caller
 }
 
+/**
+ * Add a serial character to the line, keeping the running checksum
+ * and the position of the last '*' up to date.
+ */
+inline void process_serial_char(const char c, GCodeQueue::SerialState &serial) {
+  char * const buff = serial.line_buffer;
+  const int prev = serial.count;
+  const char erased = prev ? buff[prev - 1] : '\0';
+
+  process_stream_char(c, serial.input_state, buff, serial.count);
+
+  if (serial.count > prev) {                  // Character added
+    const char a = buff[prev];
+    if (a == '*') { serial.star = prev; serial.star_checksum = serial.checksum; }
+    serial.checksum ^= a;
+  }
+  else if (serial.count < prev) {             // Backspace
+    serial.checksum ^= erased;
+    if (serial.star == serial.count) {        // Find the previous '*', if any
+      uint8_t cs = 0;
+      serial.star = -1;
+      LOOP_L_N(i, serial.count) {
+        if (buff[i] == '*') { serial.star = i; serial.star_checksum = cs; }
+        cs ^= buff[i];
+      }
+    }
+  }
+}
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
@@ -403,7 +493,9 @@ void GCodeQueue::get_serial_commands() {
        * receive buffer (which limits the packet size to MAX_CMD_SIZE).
        * The receive buffer also limits the packet size for reliable transmission.
        */
-      binaryStream[card.transfer_port_index.index].receive(serial_state[card.transfer_port_index.index].line_buffer);
+      // Let commands queued ahead of the binary stream run first so moves stay in order
+      TERN_(BINARY_MOTION_STREAM, if (ring_buffer.occupied()) return);
+      binaryStream[card.transfer_port_index.index].receive(*reinterpret_cast<char (*)[MAX_CMD_SIZE]>(serial_state[card.transfer_port_index.index].line_buffer));
       return;
     }
   #endif
@@ -453,6 +545,11 @@ void GCodeQueue::get_serial_commands() {
         if (process_line_done(serial.input_state, serial.line_buffer, serial.count))
           continue;
 
+        // Take the checksum state gathered for this line and start the next one
+        const int star = serial.star;
+        uint8_t checksum = serial.star_checksum;
+        serial.start_line();
+
         char* command = serial.line_buffer;
 
         while (*command == ' ') command++;                   // Skip leading spaces
@@ -478,11 +575,10 @@ void GCodeQueue::get_serial_commands() {
             break;
           }
 
-          char *apos = strrchr(command, '*');
-          if (apos) {
-            uint8_t checksum = 0, count = uint8_t(apos - command);
-            while (count) checksum ^= command[--count];
-            if (strtol(apos + 1, nullptr, 10) != checksum) {
+          if (star >= 0) {
+            // Leading spaces aren't part of the checksum
+            if ((command - serial.line_buffer) & 1) checksum ^= ' ';
+            if (strtol(serial.line_buffer + star + 1, nullptr, 10) != checksum) {
               gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
               break;
             }
@@ -534,11 +630,11 @@ void GCodeQueue::get_serial_commands() {
           last_command_time = ms;
         #endif
 
-        // Add the command to the queue
-        ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
+        // Hand the line over to the queue
+        ring_buffer.commit_line(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
       }
       else
-        process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count);
+        process_serial_char(serial_char, serial);
 
     } // NUM_SERIAL loop
   } // queue has space, serial has data
@@ -546,6 +642,34 @@ void GCodeQueue::get_serial_commands() {
 
 #if ENABLED(SDSUPPORT)
 
+  /**
+   * Commit the complete media line in the write slot
+   */
+  void GCodeQueue::commit_media_command(const bool parsed/*=false*/) {
+    CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
+
+    // M808 L saves the sdpos of the next line. M808 loops to a new sdpos.
+    TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(command.buffer));
+
+    #if DISABLED(PARK_HEAD_ON_PAUSE)
+      // When M25 is non-blocking it can still suspend SD commands
+      // Otherwise the M125 handler needs to know SD printing is active
+      if (command.buffer[0] == 'M' && command.buffer[1] == '2' && command.buffer[2] == '5' && !NUMERIC(command.buffer[3]))
+        card.pauseSDPrint();
+    #endif
+
+    // Put the new command into the buffer (no "ok" sent)
+    ring_buffer.commit_command(true);
+    #if ENABLED(SD_COMPILED_JOBS)
+      command.parsed = parsed;
+    #else
+      UNUSED(command); UNUSED(parsed);
+    #endif
+
+    // Prime Power-Loss Recovery for the NEXT commit_command
+    TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+  }
+
   /**
    * Get lines from the SD Card until the command buffer is full
    * or until the end of the file is reached. Because this method
@@ -558,6 +682,16 @@ void GCodeQueue::get_serial_commands() {
     // Get commands if there are more in the file
     if (!IS_SD_FETCHING()) return;
 
+    #if ENABLED(SD_COMPILED_JOBS)
+      // Take pre-parsed lines from the sidecar until it hands over or runs out
+      while (compiled_job.replaying() && !ring_buffer.full()) {
+        bool parsed;
+        if (compiled_job.next(ring_buffer.commands[ring_buffer.index_w].buffer, parsed))
+          commit_media_command(parsed);
+        if (card.eof()) { card.fileHasFinished(); return; }
+      }
+    #endif
+
     int sd_count = 0;
     while (!ring_buffer.full() && !card.eof()) {
       const int16_t n = card.get();
@@ -572,22 +706,8 @@ void GCodeQueue::get_serial_commands() {
         // Reset stream state, terminate the buffer, and commit a non-empty command
         if (!is_eol && sd_count) ++sd_count;          // End of file with no newline
         if (!process_line_done(sd_input_state, command.buffer, sd_count)) {
-
-          // M808 L saves the sdpos of the next line. M808 loops to a new sdpos.
-          TERN_(GCODE_REPEAT_MARKERS, repeat.early_parse_M808(command.buffer));
-
-          #if DISABLED(PARK_HEAD_ON_PAUSE)
-            // When M25 is non-blocking it can still suspend SD commands
-            // Otherwise the M125 handler needs to know SD printing is active
-            if (command.buffer[0] == 'M' && command.buffer[1] == '2' && command.buffer[2] == '5' && !NUMERIC(command.buffer[3]))
-              card.pauseSDPrint();
-          #endif
-
-          // Put the new command into the buffer (no "ok" sent)
-          ring_buffer.commit_command(true);
-
-          // Prime Power-Loss Recovery for the NEXT commit_command
-          TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+          TERN_(SD_COMPILED_JOBS, compiled_job.record(command.buffer, card.getIndex()));
+          commit_media_command();
         }
 
         if (card.eof()) card.fileHasFinished();         // Handle end of file reached
@@ -606,7 +726,11 @@ void GCodeQueue::get_serial_commands() {
  *  - The SD card file being actively printed
  */
 void GCodeQueue::get_available_commands() {
-  if (ring_buffer.full()) return;
+  if (ring_buffer.full()) {
+    // While the queue is full, fetch the next media block ahead of need
+    TERN_(SD_READ_AHEAD, if (IS_SD_FETCHING() && !TERN0(SD_COMPILED_JOBS, compiled_job.replaying())) card.read_ahead());
+    return;
+  }
 
   get_serial_commands();
 
@@ -649,6 +773,19 @@ void GCodeQueue::advance() {
     }
   #endif
 
+  #if ENABLED(MATERIAL_GATE_HOLD)
+    // Hold a dispensing start until the material gate opens
+    if (!TERN0(SDSUPPORT, card.flag.saving)) switch (material_gate.hold(ring_buffer.peek_next_command_string())) {
+      case MaterialGate::HOLD_WAIT: return;
+      case MaterialGate::HOLD_DROP: ok_to_send(); ring_buffer.advance_pos(ring_buffer.index_r, -1); return;
+      default: break;
+    }
+  #endif
+
+  #if ENABLED(PREDICTIVE_HEATUP)
+    const uint8_t heatup_resets = predictive_heatup.resets; // Changed if the handler clears the queue
+  #endif
+
   #if ENABLED(SDSUPPORT)
 
     if (card.flag.saving) {
@@ -687,6 +824,9 @@ void GCodeQueue::advance() {
 
   #endif // SDSUPPORT
 
+  // A command that cleared the queue also restarted the sequence numbers
+  TERN_(PREDICTIVE_HEATUP, if (heatup_resets == predictive_heatup.resets) predictive_heatup.executed());
+
   // The queue may be reset by a command handler or by code invoked by idle() within a handler
   ring_buffer.advance_pos(ring_buffer.index_r, -1);
 }
@@ -721,7 +861,7 @@ void GCodeQueue::advance() {
 
     if (auto_buffer_report_interval && ELAPSED(ms, next_buffer_report_ms)) {
       next_buffer_report_ms = ms + 1000UL * auto_buffer_report_interval;
-      PORT_REDIRECT(SerialMask::All);
+      PORT_REDIRECT(SERIAL_CHANNEL_MASK(HOST));
       report_buffer_statistics();
       PORT_RESTORE();
     }
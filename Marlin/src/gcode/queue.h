@@ -28,8 +28,14 @@
 
 #include "../inc/MarlinConfig.h"
 
+#if ENABLED(PREDICTIVE_HEATUP)
+  #include "../feature/predictive_heatup.h"
+#endif
+
 class GCodeQueue {
 public:
+  GCodeQueue();
+
   /**
    * The buffers per serial port.
    */
@@ -41,8 +47,18 @@ public:
      */
     long last_N;
     int count;                      //!< Number of characters read in the current line of serial input
-    char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
+    char *line_buffer;              //!< The current line accumulator (a spare command buffer)
     uint8_t input_state;            //!< The input state
+
+    /**
+     * The checksum is accumulated as characters arrive so the
+     * completed line doesn't have to be scanned again.
+     */
+    uint8_t checksum;               //!< XOR of all characters in the current line
+    uint8_t star_checksum;          //!< XOR of the characters ahead of the last '*'
+    int star;                       //!< Position of the last '*' in the line, or -1
+
+    inline void start_line() { count = 0; checksum = 0; star = -1; }
   };
 
   static SerialState serial_state[NUM_SERIAL]; //!< Serial states for each serial port
@@ -51,17 +67,27 @@ public:
    * GCode Command Queue
    * A simple (circular) ring buffer of BUFSIZE command strings.
    *
-   * Commands are copied into this buffer by the command injectors
+   * Commands are placed into this buffer by the command injectors
    * (immediate, serial, sd card) and they are processed sequentially by
    * the main loop. The gcode.process_next_command method parses the next
    * command and hands off execution to individual handler functions.
+   *
+   * Each slot points into a shared pool of line buffers. SD lines are read
+   * straight into the write slot, while each serial port accumulates into a
+   * spare buffer that is swapped into the ring when the line is accepted.
    */
   struct CommandLine {
-    char buffer[MAX_CMD_SIZE];      //!< The command buffer
+    char *buffer;                   //!< The command buffer
     bool skip_ok;                   //!< Skip sending ok when command is processed?
+    #if ENABLED(SD_COMPILED_JOBS)
+      bool parsed;                  //!< The parse state follows the text in the buffer
+    #endif
     #if HAS_MULTI_SERIAL
       serial_index_t port;          //!< Serial port the command was received on
     #endif
+    #if ENABLED(EMERGENCY_OVERRIDES)
+      bool override_taken;          //!< Already applied on arrival by the emergency parser
+    #endif
   };
 
   /**
@@ -87,8 +113,16 @@ public:
       OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind = serial_index_t())
     );
 
+    void commit_line(char* &line, bool skip_ok
+      OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind = serial_index_t())
+    );
+
     void ok_to_send();
 
+    #if ENABLED(MOVE_COALESCING)
+      void retire_next();
+    #endif
+
     inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
 
     inline bool occupied() const { return length != 0; }
@@ -108,7 +142,10 @@ public:
   /**
    * Clear the Marlin command queue
    */
-  static void clear() { ring_buffer.clear(); }
+  static void clear() {
+    ring_buffer.clear();
+    TERN_(PREDICTIVE_HEATUP, predictive_heatup.reset());
+  }
 
   /**
    * Next Injected Command (PROGMEM) pointer. (nullptr == empty)
@@ -252,6 +289,7 @@ private:
 
   #if ENABLED(SDSUPPORT)
     static void get_sdcard_commands();
+    static void commit_media_command(const bool parsed=false);
   #endif
 
   // Process the next "immediate" command (PROGMEM)
@@ -88,8 +88,9 @@ void GcodeSuite::M1001() {
 
   // Announce SD file completion
   {
-    PORT_REDIRECT(SerialMask::All);
+    PORT_REDIRECT(SERIAL_CHANNEL_MASK(HOST));
     SERIAL_ECHOLNPGM(STR_FILE_PRINTED);
+    CHANNEL_REDIRECT(PANEL);
     SERIAL_ECHOPGM("\xFF\xFF\xFF");
     SERIAL_ECHOPGM("page PRINTDONE");  // yazdırma bittiğinde ekrana bildirim gelmesi.
     SERIAL_ECHOPGM("\xFF\xFF\xFF");
@@ -35,9 +35,12 @@
  * M524: Abort the current SD print job (started with M24)
  */
 void GcodeSuite::M524() {
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
-  SERIAL_ECHOPGM("t10.txt=\"Aborting print...\"");
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
+  {
+    CHANNEL_REDIRECT(PANEL);
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+    SERIAL_ECHOPGM("t10.txt=\"Aborting print...\"");
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+  }
   #if ENABLED(DWIN_LCD_PROUI)
 
     HMI_flag.abort_flag = true;    // The LCD will handle it
@@ -735,6 +735,16 @@
   #define CUTTER_UNIT_IS(V)    (_CUTTER_POWER(CUTTER_POWER_UNIT) == _CUTTER_POWER(V))
 #endif
 
+// Size the command queue to fit COMMAND_BUFFER_RAM. Each slot holds a line
+// buffer, a CommandLine, and a power-loss SD position.
+#if !defined(BUFSIZE) && defined(COMMAND_BUFFER_RAM)
+  #if (COMMAND_BUFFER_RAM) / (MAX_CMD_SIZE + 12) > 255
+    #define BUFSIZE 255
+  #else
+    #define BUFSIZE ((COMMAND_BUFFER_RAM) / (MAX_CMD_SIZE + 12))
+  #endif
+#endif
+
 #if !defined(__AVR__) || !defined(USBCON)
   // Define constants and variables for buffering serial data.
   // Use only 0 or powers of 2 greater than 1
@@ -756,6 +766,16 @@
   #define HAS_GCODE_M876 1
 #endif
 
+// P000 / R000 to hold and resume motion from the emergency parser
+#if EITHER(REALTIME_REPORTING_COMMANDS, EMERGENCY_OVERRIDES)
+  #define HAS_QUICK_PAUSE 1
+#endif
+
+// Save and restore the dispensing valves with power-loss recovery
+#if BOTH(POWER_LOSS_RECOVERY, EMERGENCY_OVERRIDES) && defined(EMERGENCY_VALVE_PINS)
+  #define HAS_PLR_VALVES 1
+#endif
+
 #if ENABLED(HOST_ACTION_COMMANDS)
   #ifndef ACTION_ON_PAUSE
     #define ACTION_ON_PAUSE   "pause"
@@ -2115,7 +2115,11 @@
   #define HAS_TMC_HW_SERIAL 1
 #endif
 #if ANY_AXIS_HAS(SW_SERIAL)
-  #define HAS_TMC_SW_SERIAL 1
+  #if ENABLED(TMC_SERIAL_DMA)
+    #define HAS_TMC_DMA_SERIAL 1
+  #else
+    #define HAS_TMC_SW_SERIAL 1
+  #endif
 #endif
 
 #if DISABLED(SENSORLESS_HOMING)
@@ -2524,6 +2528,7 @@
 #endif
 #if NONE(THERMAL_PROTECTION_HOTENDS, THERMAL_PROTECTION_CHAMBER, THERMAL_PROTECTION_BED, THERMAL_PROTECTION_COOLER)
   #undef THERMAL_PROTECTION_VARIANCE_MONITOR
+  #undef THERMAL_PROTECTION_MODEL
 #endif
 #if  (ENABLED(THERMAL_PROTECTION_HOTENDS) || !EXTRUDERS) \
   && (ENABLED(THERMAL_PROTECTION_BED)     || !HAS_HEATED_BED) \
@@ -2532,6 +2537,36 @@
   #define THERMALLY_SAFE 1
 #endif
 
+#if ENABLED(MATERIAL_GATE)
+  #if HAS_TEMP_CHAMBER && (defined(MATERIAL_GATE_CHAMBER_MIN) || defined(MATERIAL_GATE_CHAMBER_MAX))
+    #define HAS_MATERIAL_GATE_CHAMBER 1
+    #ifndef MATERIAL_GATE_CHAMBER_MIN
+      #define MATERIAL_GATE_CHAMBER_MIN -1000
+    #endif
+    #ifndef MATERIAL_GATE_CHAMBER_MAX
+      #define MATERIAL_GATE_CHAMBER_MAX 1000
+    #endif
+  #endif
+  #if HAS_TEMP_HOTEND && (defined(MATERIAL_GATE_MATERIAL_MIN) || defined(MATERIAL_GATE_MATERIAL_MAX))
+    #define HAS_MATERIAL_GATE_MATERIAL 1
+    #ifndef MATERIAL_GATE_MATERIAL_MIN
+      #define MATERIAL_GATE_MATERIAL_MIN -1000
+    #endif
+    #ifndef MATERIAL_GATE_MATERIAL_MAX
+      #define MATERIAL_GATE_MATERIAL_MAX 1000
+    #endif
+  #endif
+  #if HAS_TEMP_BED && (defined(MATERIAL_GATE_BED_MIN) || defined(MATERIAL_GATE_BED_MAX))
+    #define HAS_MATERIAL_GATE_BED 1
+    #ifndef MATERIAL_GATE_BED_MIN
+      #define MATERIAL_GATE_BED_MIN -1000
+    #endif
+    #ifndef MATERIAL_GATE_BED_MAX
+      #define MATERIAL_GATE_BED_MAX 1000
+    #endif
+  #endif
+#endif
+
 // Auto fans
 #if HAS_HOTEND && PIN_EXISTS(E0_AUTO_FAN)
   #define HAS_AUTO_FAN_0 1
@@ -3146,6 +3181,9 @@
 #if ENABLED(SEGMENT_LEVELED_MOVES) && !defined(LEVELED_SEGMENT_LENGTH)
   #define LEVELED_SEGMENT_LENGTH 5
 #endif
+#if ENABLED(SEGMENT_LEVELED_CELLS) && !defined(LEVELED_CELL_TOLERANCE)
+  #define LEVELED_CELL_TOLERANCE 0.01
+#endif
 
 /**
  * Default mesh area is an area with an inset margin on the print area.
@@ -799,6 +799,17 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "SERIAL_PORT_3 cannot be the same as SERIAL_PORT_2."
   #endif
 #endif
+#if ENABLED(SERIAL_OUTPUT_CHANNELS)
+  #ifndef SERIAL_PORT_2
+    #error "SERIAL_OUTPUT_CHANNELS requires SERIAL_PORT_2."
+  #elif !defined(SERIAL_HOST_PORTS) || !defined(SERIAL_PANEL_PORTS) || !defined(SERIAL_DEBUG_PORTS)
+    #error "SERIAL_OUTPUT_CHANNELS requires SERIAL_HOST_PORTS, SERIAL_PANEL_PORTS and SERIAL_DEBUG_PORTS."
+  #elif !WITHIN(SERIAL_HOST_PORTS, 1, _BV(NUM_SERIAL) - 1)
+    #error "SERIAL_HOST_PORTS must include at least one serial port and no others."
+  #elif !WITHIN(SERIAL_PANEL_PORTS, 0, _BV(NUM_SERIAL) - 1) || !WITHIN(SERIAL_DEBUG_PORTS, 0, _BV(NUM_SERIAL) - 1)
+    #error "SERIAL_PANEL_PORTS and SERIAL_DEBUG_PORTS may only include existing serial ports."
+  #endif
+#endif
 #if !(defined(__AVR__) && defined(USBCON))
   #if ENABLED(SERIAL_XON_XOFF) && RX_BUFFER_SIZE < 1024
     #error "SERIAL_XON_XOFF requires RX_BUFFER_SIZE >= 1024 for reliable transfers without drops."
@@ -997,6 +1008,32 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #endif
 #endif
 
+/**
+ * SD Read Ahead
+ */
+#if ENABLED(SD_READ_AHEAD) && !WITHIN(SD_READ_AHEAD_BLOCKS, 1, 255)
+  #error "SD_READ_AHEAD_BLOCKS must be between 1 and 255."
+#endif
+#if SD_FAT_CACHE_BLOCKS < 0 || SD_FAT_CACHE_BLOCKS > 16
+  #error "SD_FAT_CACHE_BLOCKS must be between 0 and 16."
+#endif
+#if ENABLED(SD_FREE_CLUSTER_MAP) && !WITHIN(SD_FREE_CLUSTER_MAP_BYTES, 1, 4096)
+  #error "SD_FREE_CLUSTER_MAP_BYTES must be between 1 and 4096."
+#endif
+
+/**
+ * SD Compiled Jobs
+ */
+#if ENABLED(SD_COMPILED_JOBS)
+  #if ENABLED(SDCARD_READONLY)
+    #error "SD_COMPILED_JOBS is incompatible with SDCARD_READONLY."
+  #elif DISABLED(FASTER_GCODE_PARSER)
+    #error "SD_COMPILED_JOBS requires FASTER_GCODE_PARSER."
+  #elif ENABLED(GCODE_MOTION_MODES)
+    #error "SD_COMPILED_JOBS is incompatible with GCODE_MOTION_MODES."
+  #endif
+#endif
+
 #if defined(EVENT_GCODE_SD_ABORT) && DISABLED(NOZZLE_PARK_FEATURE)
   static_assert(nullptr == strstr(EVENT_GCODE_SD_ABORT, "G27"), "NOZZLE_PARK_FEATURE is required to use G27 in EVENT_GCODE_SD_ABORT.");
 #endif
@@ -1933,6 +1970,14 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "Z_PROBE_LOW_POINT must be less than or equal to 0."
   #endif
 
+  #if ENABLED(PROBE_FAST_PREDICTED)
+    #if ENABLED(BD_SENSOR)
+      #error "PROBE_FAST_PREDICTED is not compatible with BD_SENSOR."
+    #endif
+    static_assert(PROBE_PREDICTED_TOLERANCE > 0, "PROBE_PREDICTED_TOLERANCE must be greater than 0.");
+    static_assert(WITHIN(PROBE_PREDICTED_CLEARANCE, 0.5, Z_CLEARANCE_BETWEEN_PROBES), "PROBE_PREDICTED_CLEARANCE must be between 0.5 and Z_CLEARANCE_BETWEEN_PROBES.");
+  #endif
+
   #if ENABLED(PROBE_ACTIVATION_SWITCH)
     #ifndef PROBE_ACTIVATION_SWITCH_STATE
       #error "PROBE_ACTIVATION_SWITCH_STATE is required for PROBE_ACTIVATION_SWITCH."
@@ -1954,6 +1999,10 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "Z_MIN_PROBE_REPEATABILITY_TEST requires a real probe."
   #endif
 
+  #if ENABLED(PROBE_FAST_PREDICTED)
+    #error "PROBE_FAST_PREDICTED requires a real probe."
+  #endif
+
 #endif
 
 #if ENABLED(LCD_BED_TRAMMING)
@@ -2006,6 +2055,30 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "SCARA machines can only use the AUTO_BED_LEVELING_BILINEAR leveling option."
   #endif
 
+  #if ENABLED(ADAPTIVE_G29)
+    #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+      #error "ADAPTIVE_G29 requires AUTO_BED_LEVELING_BILINEAR."
+    #elif ENABLED(PROBE_MANUALLY)
+      #error "ADAPTIVE_G29 is not compatible with PROBE_MANUALLY."
+    #elif IS_KINEMATIC
+      #error "ADAPTIVE_G29 requires a Cartesian machine."
+    #elif GRID_MAX_POINTS_X < 4 && GRID_MAX_POINTS_Y < 4
+      #error "ADAPTIVE_G29 requires at least 4 grid points on one axis."
+    #endif
+    static_assert(ADAPTIVE_G29_TOLERANCE > 0, "ADAPTIVE_G29_TOLERANCE must be greater than 0.");
+  #endif
+
+  #if ENABLED(SEGMENT_LEVELED_CELLS)
+    #if !IS_CARTESIAN || DISABLED(AUTO_BED_LEVELING_BILINEAR)
+      #error "SEGMENT_LEVELED_CELLS requires AUTO_BED_LEVELING_BILINEAR on a Cartesian machine."
+    #elif DISABLED(SEGMENT_LEVELED_MOVES)
+      #error "SEGMENT_LEVELED_CELLS requires SEGMENT_LEVELED_MOVES."
+    #elif ENABLED(ABL_BILINEAR_SUBDIVISION) && (GRID_MAX_CELLS_X * (BILINEAR_SUBDIVISIONS) > 16 || GRID_MAX_CELLS_Y * (BILINEAR_SUBDIVISIONS) > 16)
+      #error "SEGMENT_LEVELED_CELLS allows at most 16 subdivided grid cells per axis."
+    #endif
+    static_assert(LEVELED_CELL_TOLERANCE > 0, "LEVELED_CELL_TOLERANCE must be greater than 0.");
+  #endif
+
 #elif ENABLED(MESH_BED_LEVELING)
 
   // Mesh Bed Leveling
@@ -2546,6 +2619,49 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "TEMP_SENSOR_BOARD requires TEMP_BOARD_PIN."
 #endif
 
+#if ENABLED(THERMAL_PROTECTION_MODEL)
+  #if EITHER(ADAPTIVE_FAN_SLOWING, THERMAL_PROTECTION_VARIANCE_MONITOR)
+    #error "THERMAL_PROTECTION_MODEL replaces the runaway state machine used by ADAPTIVE_FAN_SLOWING and THERMAL_PROTECTION_VARIANCE_MONITOR."
+  #elif defined(THERMAL_MODEL_HOTEND_GAIN) || defined(THERMAL_MODEL_HOTEND_TAU) || defined(THERMAL_MODEL_BED_GAIN) || defined(THERMAL_MODEL_BED_TAU)
+    #error "THERMAL_MODEL_*_GAIN and THERMAL_MODEL_*_TAU are now learned (or taken from MPCTEMP). Please remove them from Configuration_adv.h."
+  #elif !(THERMAL_MODEL_TRIP_TIME > 0)
+    #error "THERMAL_MODEL_TRIP_TIME must be greater than 0."
+  #endif
+  static_assert(WITHIN(THERMAL_MODEL_TRACKING, 0, 0.05), "THERMAL_MODEL_TRACKING must be between 0 and 0.05.");
+#endif
+
+#if ENABLED(HEATER_HARDWARE_PWM)
+  #ifndef HAL_STM32
+    #error "HEATER_HARDWARE_PWM is currently only supported on STM32."
+  #elif ENABLED(SLOW_PWM_HEATERS)
+    #error "HEATER_HARDWARE_PWM is incompatible with SLOW_PWM_HEATERS."
+  #elif ENABLED(HEATERS_PARALLEL)
+    #error "HEATER_HARDWARE_PWM is incompatible with HEATERS_PARALLEL."
+  #elif defined(BOARD_OPENDRAIN_MOSFETS)
+    #error "HEATER_HARDWARE_PWM is not supported on boards with open-drain heater MOSFETs."
+  #elif !(HEATER_PWM_FREQUENCY > 0)
+    #error "HEATER_PWM_FREQUENCY must be greater than 0."
+  #endif
+#endif
+
+#if ENABLED(MATERIAL_GATE)
+  #if NONE(HAS_MATERIAL_GATE_CHAMBER, HAS_MATERIAL_GATE_MATERIAL, HAS_MATERIAL_GATE_BED)
+    #error "MATERIAL_GATE requires a chamber, material or bed limit with a matching temperature sensor."
+  #elif !(MATERIAL_GATE_INTERVAL > 0)
+    #error "MATERIAL_GATE_INTERVAL must be greater than 0."
+  #elif ENABLED(MATERIAL_GATE_HOLD) && !(MATERIAL_GATE_TIMEOUT > 0)
+    #error "MATERIAL_GATE_TIMEOUT must be greater than 0."
+  #endif
+  static_assert(MATERIAL_GATE_HYSTERESIS >= 0, "MATERIAL_GATE_HYSTERESIS must be 0 or greater.");
+#endif
+
+#if ENABLED(MOVE_COALESCING)
+  static_assert(MOVE_COALESCE_TOLERANCE > 0, "MOVE_COALESCE_TOLERANCE must be greater than 0.");
+  static_assert(MOVE_COALESCE_MAX_SEGMENT > 0, "MOVE_COALESCE_MAX_SEGMENT must be greater than 0.");
+  static_assert(MOVE_COALESCE_MAX_LENGTH >= MOVE_COALESCE_MAX_SEGMENT, "MOVE_COALESCE_MAX_LENGTH must be at least MOVE_COALESCE_MAX_SEGMENT.");
+  static_assert(MOVE_COALESCE_E_RATIO >= 0, "MOVE_COALESCE_E_RATIO must be 0 or greater.");
+#endif
+
 #if ENABLED(LASER_COOLANT_FLOW_METER) && !(PIN_EXISTS(FLOWMETER) && ENABLED(LASER_FEATURE))
   #error "LASER_COOLANT_FLOW_METER requires FLOWMETER_PIN and LASER_FEATURE."
 #endif
@@ -2802,6 +2918,9 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
 #if ENABLED(SOFT_RESET_VIA_SERIAL) && DISABLED(EMERGENCY_PARSER)
   #error "EMERGENCY_PARSER is required to activate SOFT_RESET_VIA_SERIAL."
 #endif
+#if ENABLED(EMERGENCY_OVERRIDES) && DISABLED(EMERGENCY_PARSER)
+  #error "EMERGENCY_PARSER is required to activate EMERGENCY_OVERRIDES."
+#endif
 #if ENABLED(SOFT_RESET_ON_KILL) && !BUTTON_EXISTS(ENC)
   #error "An encoder button is required or SOFT_RESET_ON_KILL will reset the printer without notice!"
 #endif
@@ -2940,6 +3059,9 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "Please select only one method of EEPROM Persistent Storage."
   #endif
 #endif
+#if ENABLED(EEPROM_SECTIONS) && ENABLED(AUTO_BED_LEVELING_UBL)
+  #error "EEPROM_SECTIONS is incompatible with AUTO_BED_LEVELING_UBL, which keeps mesh slots at the end of the EEPROM."
+#endif
 
 /**
  * Make sure features that need to write to the SD card can
@@ -3244,6 +3366,64 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
 #endif
 #undef INVALID_TMC_SPI
 
+/**
+ * TMC serial over timer and DMA
+ */
+#if ENABLED(TMC_SERIAL_DMA)
+  #ifndef HAL_STM32
+    #error "TMC_SERIAL_DMA requires an STM32 board."
+  #elif !HAS_TMC_UART
+    #error "TMC_SERIAL_DMA requires TMC2208 or TMC2209 drivers."
+  #endif
+  #define INVALID_TMC_DMA(ST) (AXIS_HAS_SW_SERIAL(ST) && ST##_SERIAL_RX_PIN != ST##_SERIAL_TX_PIN)
+  #if INVALID_TMC_DMA(X)
+    #error "TMC_SERIAL_DMA requires X_SERIAL_RX_PIN to be the same as X_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(X2)
+    #error "TMC_SERIAL_DMA requires X2_SERIAL_RX_PIN to be the same as X2_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(Y)
+    #error "TMC_SERIAL_DMA requires Y_SERIAL_RX_PIN to be the same as Y_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(Y2)
+    #error "TMC_SERIAL_DMA requires Y2_SERIAL_RX_PIN to be the same as Y2_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(Z)
+    #error "TMC_SERIAL_DMA requires Z_SERIAL_RX_PIN to be the same as Z_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(Z2)
+    #error "TMC_SERIAL_DMA requires Z2_SERIAL_RX_PIN to be the same as Z2_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(Z3)
+    #error "TMC_SERIAL_DMA requires Z3_SERIAL_RX_PIN to be the same as Z3_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(Z4)
+    #error "TMC_SERIAL_DMA requires Z4_SERIAL_RX_PIN to be the same as Z4_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(E0)
+    #error "TMC_SERIAL_DMA requires E0_SERIAL_RX_PIN to be the same as E0_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(E1)
+    #error "TMC_SERIAL_DMA requires E1_SERIAL_RX_PIN to be the same as E1_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(E2)
+    #error "TMC_SERIAL_DMA requires E2_SERIAL_RX_PIN to be the same as E2_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(E3)
+    #error "TMC_SERIAL_DMA requires E3_SERIAL_RX_PIN to be the same as E3_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(E4)
+    #error "TMC_SERIAL_DMA requires E4_SERIAL_RX_PIN to be the same as E4_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(E5)
+    #error "TMC_SERIAL_DMA requires E5_SERIAL_RX_PIN to be the same as E5_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(E6)
+    #error "TMC_SERIAL_DMA requires E6_SERIAL_RX_PIN to be the same as E6_SERIAL_TX_PIN."
+  #elif INVALID_TMC_DMA(E7)
+    #error "TMC_SERIAL_DMA requires E7_SERIAL_RX_PIN to be the same as E7_SERIAL_TX_PIN."
+  #elif HAS_I_AXIS && INVALID_TMC_DMA(I)
+    #error "TMC_SERIAL_DMA requires I_SERIAL_RX_PIN to be the same as I_SERIAL_TX_PIN."
+  #elif HAS_J_AXIS && INVALID_TMC_DMA(J)
+    #error "TMC_SERIAL_DMA requires J_SERIAL_RX_PIN to be the same as J_SERIAL_TX_PIN."
+  #elif HAS_K_AXIS && INVALID_TMC_DMA(K)
+    #error "TMC_SERIAL_DMA requires K_SERIAL_RX_PIN to be the same as K_SERIAL_TX_PIN."
+  #elif HAS_U_AXIS && INVALID_TMC_DMA(U)
+    #error "TMC_SERIAL_DMA requires U_SERIAL_RX_PIN to be the same as U_SERIAL_TX_PIN."
+  #elif HAS_V_AXIS && INVALID_TMC_DMA(V)
+    #error "TMC_SERIAL_DMA requires V_SERIAL_RX_PIN to be the same as V_SERIAL_TX_PIN."
+  #elif HAS_W_AXIS && INVALID_TMC_DMA(W)
+    #error "TMC_SERIAL_DMA requires W_SERIAL_RX_PIN to be the same as W_SERIAL_TX_PIN."
+  #endif
+  #undef INVALID_TMC_DMA
+#endif
+
 /**
  * Check existing RX/TX pins against enable TMC UART drivers.
  */
@@ -3837,6 +4017,12 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
     #error "POWER_LOSS_RECOVER_ZHOME is not needed on a machine that homes to ZMAX."
   #elif BOTH(IS_CARTESIAN, POWER_LOSS_RECOVER_ZHOME) && Z_HOME_TO_MIN && !defined(POWER_LOSS_ZHOME_POS)
     #error "POWER_LOSS_RECOVER_ZHOME requires POWER_LOSS_ZHOME_POS for a Cartesian that homes to ZMIN."
+  #elif ENABLED(POWER_LOSS_JOURNAL) && ENABLED(SDCARD_READONLY)
+    #error "POWER_LOSS_JOURNAL is incompatible with SDCARD_READONLY."
+  #elif ENABLED(POWER_LOSS_JOURNAL) && !WITHIN(POWER_LOSS_JOURNAL_BLOCKS, 4, 1024)
+    #error "POWER_LOSS_JOURNAL_BLOCKS must be between 4 and 1024."
+  #elif ENABLED(POWER_LOSS_JOURNAL) && !WITHIN(POWER_LOSS_JOURNAL_CHECKPOINT, 1, 255)
+    #error "POWER_LOSS_JOURNAL_CHECKPOINT must be between 1 and 255."
   #endif
 #endif
 
@@ -4130,12 +4316,24 @@ static_assert(_PLUS_TEST(4), "HOMING_FEEDRATE_MM_M values must be positive.");
   #endif
 #endif
 
+/**
+ * Command queue size
+ */
+#ifndef BUFSIZE
+  #error "Either BUFSIZE or COMMAND_BUFFER_RAM is required."
+#elif !WITHIN(BUFSIZE, 2, 255)
+  #error "BUFSIZE (or the size from COMMAND_BUFFER_RAM) must be from 2 to 255."
+#endif
+
 /**
  * Sanity Check for MEATPACK and BINARY_FILE_TRANSFER Features
  */
 #if BOTH(HAS_MEATPACK, BINARY_FILE_TRANSFER)
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
+#if ENABLED(BINARY_MOTION_STREAM) && DISABLED(BINARY_FILE_TRANSFER)
+  #error "BINARY_MOTION_STREAM requires BINARY_FILE_TRANSFER."
+#endif
 
 /**
  * Sanity Check for Slim LCD Menus and Probe Offset Wizard
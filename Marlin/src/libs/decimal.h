@@ -0,0 +1,74 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * decimal.h - Direct conversion of plain decimal strings to float
+ *
+ * This has no configuration dependencies, so it is also built by the host unit tests.
+ */
+
+#include "../core/macros.h"
+#include <stdint.h>
+
+/**
+ * Convert a plain decimal (sign, digits, one point) that ends at any other character.
+ *
+ * Up to 7 significant digits are converted directly. The digits and the power
+ * of ten are both exact as floats, so a single division gives the same
+ * correctly-rounded result as strtof. Trailing zeros after the point don't
+ * count toward the limit.
+ *
+ * Return 'false' for any other form, leaving the conversion to strtof.
+ */
+inline bool decimal_to_float(const char *p, float &f) {
+  static constexpr float pow10[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+  const bool neg = (*p == '-');
+  if (neg || *p == '+') ++p;
+
+  uint32_t digits = 0;                // Significant digits as an integer
+  uint8_t places = 0, zeros = 0;      // Digits after the point, and trailing zeros held back
+  bool point = false, any = false;
+  for (;; ++p) {
+    const char c = *p;
+    if (NUMERIC(c)) {
+      any = true;
+      if (point && c == '0') { ++zeros; continue; }
+      for (; zeros; --zeros, ++places)
+        if ((digits *= 10) >= _BV32(24)) return false;
+      digits = digits * 10 + (c - '0');
+      if (point) ++places;
+      if (digits >= _BV32(24) || places >= COUNT(pow10)) return false;
+    }
+    else if (c == '.' && !point)
+      point = true;
+    else
+      break;
+  }
+
+  if (!any) return false;
+
+  f = places ? float(digits) / pow10[places] : float(digits);
+  if (neg) f = -f;
+  return true;
+}
@@ -574,6 +574,7 @@ static void print_es_state(const bool is_hit, FSTR_P const flabel=nullptr) {
 }
 int k = 0;
 static void print_es_states(const bool is_hit, FSTR_P const flabel=nullptr) {
+  CHANNEL_REDIRECT(PANEL);
   if(is_hit ){
     SERIAL_ECHOPGM("\xFF\xFF\xFF");
     SERIAL_ECHOPGM("t06.txt=\"","Filament var\"");
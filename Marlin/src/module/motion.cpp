@@ -381,7 +381,7 @@ void quickstop_stepper() {
   sync_plan_position();
 }
 
-#if ENABLED(REALTIME_REPORTING_COMMANDS)
+#if HAS_QUICK_PAUSE
 
   void quickpause_stepper() {
     planner.quick_pause();
@@ -1070,7 +1070,8 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
    * the bedlevel.line_to_destination_segmented method replaces this.
    *
    * For Auto Bed Leveling (Bilinear) with SEGMENT_LEVELED_MOVES
-   * this is replaced by segmented_line_to_destination below.
+   * this is replaced by segmented_line_to_destination below, or by
+   * bedlevel.line_to_destination with SEGMENT_LEVELED_CELLS.
    */
   inline bool line_to_destination_kinematic() {
 
@@ -1148,7 +1149,7 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
 
 #else // !IS_KINEMATIC
 
-  #if ENABLED(SEGMENT_LEVELED_MOVES) && DISABLED(AUTO_BED_LEVELING_UBL)
+  #if ENABLED(SEGMENT_LEVELED_MOVES) && NONE(AUTO_BED_LEVELING_UBL, SEGMENT_LEVELED_CELLS)
 
     /**
      * Prepare a segmented move on a CARTESIAN setup.
@@ -1208,7 +1209,7 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
       planner.buffer_line(destination, fr_mm_s, active_extruder, hints);
     }
 
-  #endif // SEGMENT_LEVELED_MOVES && !AUTO_BED_LEVELING_UBL
+  #endif // SEGMENT_LEVELED_MOVES && !AUTO_BED_LEVELING_UBL && !SEGMENT_LEVELED_CELLS
 
   /**
    * Prepare a linear move in a Cartesian setup.
@@ -1229,7 +1230,7 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
             bedlevel.line_to_destination_cartesian(scaled_fr_mm_s, active_extruder); // UBL's motion routine needs to know about
             return true;                                                             // all moves, including Z-only moves.
           #endif
-        #elif ENABLED(SEGMENT_LEVELED_MOVES)
+        #elif ENABLED(SEGMENT_LEVELED_MOVES) && DISABLED(SEGMENT_LEVELED_CELLS)
           segmented_line_to_destination(scaled_fr_mm_s);
           return false; // caller will update current_position
         #else
@@ -293,11 +293,11 @@ void report_current_position_projected();
       }
     }
   #endif
+#endif
 
-  #if ENABLED(REALTIME_REPORTING_COMMANDS)
-    void quickpause_stepper();
-    void quickresume_stepper();
-  #endif
+#if HAS_QUICK_PAUSE
+  void quickpause_stepper();
+  void quickresume_stepper();
 #endif
 
 void get_cartesian_from_steppers();
@@ -1696,7 +1696,7 @@ void Planner::quick_stop() {
   stepper.quick_stop();
 }
 
-#if ENABLED(REALTIME_REPORTING_COMMANDS)
+#if HAS_QUICK_PAUSE
 
   void Planner::quick_pause() {
     // Suspend until quick_resume is called
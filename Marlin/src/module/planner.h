@@ -916,7 +916,7 @@ class Planner {
     // a Full Shutdown is required, or when endstops are hit)
     static void quick_stop();
 
-    #if ENABLED(REALTIME_REPORTING_COMMANDS)
+    #if HAS_QUICK_PAUSE
       // Force a quick pause of the machine (e.g., when a pause is required in the middle of move).
       // NOTE: Hard-stops will lose steps so encoders are highly recommended if using these!
       static void quick_pause();
@@ -111,6 +111,12 @@ xyz_pos_t Probe::offset; // Initialized by settings.load()
   const xy_pos_t &Probe::offset_xy = Probe::offset;
 #endif
 
+#if ENABLED(PROBE_FAST_PREDICTED)
+  float Probe::predicted_z = NAN,
+        Probe::fast_offset = NAN;
+  static bool short_raise; // The last raise was only PROBE_PREDICTED_CLEARANCE
+#endif
+
 #if ENABLED(SENSORLESS_PROBING)
   Probe::sense_bool_t Probe::test_sensitivity = { true, true, true };
 #endif
@@ -720,6 +726,29 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
   // If Z isn't known then probe to -10mm.
   const float z_probe_low_point = axis_is_trusted(Z_AXIS) ? -offset.z + Z_PROBE_LOW_POINT : -10.0;
 
+  #if ENABLED(PROBE_FAST_PREDICTED)
+    // With a prediction a single fast touch may be enough
+    float fast_z = NAN;
+    if (!isnan(predicted_z)) {
+      if (TERN0(PROBE_TARE, tare())) return NAN;
+
+      if (try_to_probe(PSTR("FAST"), z_probe_low_point, z_probe_fast_mm_s,
+                       sanity_check, Z_CLEARANCE_BETWEEN_PROBES) ) return NAN;
+
+      fast_z = DIFF_TERN(HAS_DELTA_SENSORLESS_PROBING, current_position.z, largest_sensorless_adj);
+
+      // The fast touch lands lower than a slow one. Correct by the offset found on the first point.
+      if (!isnan(fast_offset)) {
+        const float z = fast_z + fast_offset;
+        if (ABS(z + offset.z - predicted_z) <= PROBE_PREDICTED_TOLERANCE) return z;
+        if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Fast Z:", z + offset.z, " Predicted Z:", predicted_z);
+      }
+
+      // Not calibrated yet, or not where expected. Probe normally from just above.
+      do_blocking_move_to_z(current_position.z + (PROBE_PREDICTED_CLEARANCE), z_probe_fast_mm_s);
+    }
+  #endif
+
   // Double-probing does a fast probe followed by a slow probe
   #if TOTAL_PROBING == 2
 
@@ -837,6 +866,13 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
 
   #endif
 
+  #if ENABLED(PROBE_FAST_PREDICTED)
+    if (!isnan(fast_z) && isnan(fast_offset)) {
+      fast_offset = measured_z - fast_z;
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Fast probe offset:", fast_offset);
+    }
+  #endif
+
   return measured_z;
 }
 
@@ -875,10 +911,20 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
   );
   if (!can_reach(npos, probe_relative)) {
     if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Position Not Reachable");
+    TERN_(PROBE_FAST_PREDICTED, predicted_z = NAN);
     return NAN;
   }
   if (probe_relative) npos -= offset_xy;  // Get the nozzle position
 
+  #if ENABLED(PROBE_FAST_PREDICTED)
+    // Travel just above the predicted bed, or restore the full clearance
+    if (!isnan(predicted_z))
+      NOLESS(npos.z, predicted_z - offset.z + (PROBE_PREDICTED_CLEARANCE));
+    else if (short_raise)
+      npos.z += (Z_CLEARANCE_BETWEEN_PROBES) - (PROBE_PREDICTED_CLEARANCE);
+    short_raise = false;
+  #endif
+
   // Move the probe to the starting XYZ
   do_blocking_move_to(npos, feedRate_t(XY_PROBE_FEEDRATE_MM_S));
 
@@ -894,8 +940,16 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
   }
   if (!isnan(measured_z)) {
     const bool big_raise = raise_after == PROBE_PT_BIG_RAISE;
-    if (big_raise || raise_after == PROBE_PT_RAISE)
-      do_blocking_move_to_z(current_position.z + (big_raise ? 25 : Z_CLEARANCE_BETWEEN_PROBES), z_probe_fast_mm_s);
+    if (big_raise || raise_after == PROBE_PT_RAISE) {
+      #if ENABLED(PROBE_FAST_PREDICTED)
+        // The next point's prediction decides how much higher to go
+        short_raise = !big_raise && !isnan(predicted_z);
+        if (short_raise)
+          do_blocking_move_to_z(current_position.z + (PROBE_PREDICTED_CLEARANCE), z_probe_fast_mm_s);
+        else
+      #endif
+          do_blocking_move_to_z(current_position.z + (big_raise ? 25 : Z_CLEARANCE_BETWEEN_PROBES), z_probe_fast_mm_s);
+    }
     else if (raise_after == PROBE_PT_STOW || raise_after == PROBE_PT_LAST_STOW)
       if (stow()) measured_z = NAN;   // Error on stow?
 
@@ -910,6 +964,8 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
       SERIAL_ERROR_MSG(STR_ERR_PROBING_FAILED);
     #endif
   }
+  TERN_(PROBE_FAST_PREDICTED, predicted_z = NAN);
+
   DEBUG_ECHOLNPGM("measured_z: ", measured_z);
   return measured_z;
 }
@@ -80,6 +80,13 @@ public:
 
     static xyz_pos_t offset;
 
+    #if ENABLED(PROBE_FAST_PREDICTED)
+      // Expected bed Z at the next point (or NAN). Cleared by probe_at_point.
+      static float predicted_z;
+      // Slow minus fast probe reading, found on the first predicted point (or NAN)
+      static float fast_offset;
+    #endif
+
     #if EITHER(PREHEAT_BEFORE_PROBING, PREHEAT_BEFORE_LEVELING)
       static void preheat_for_probing(const celsius_t hotend_temp, const celsius_t bed_temp);
     #endif
@@ -755,6 +755,206 @@ void MarlinSettings::postprocess() {
     return false;
   }
 
+  #if ENABLED(EEPROM_SECTIONS)
+
+    /**
+     * Calibration Sections
+     *
+     * Machine calibration is also kept in tagged sections at the end of the
+     * EEPROM, each with a layout version, size and CRC. When the main settings
+     * can't be loaded, as after a firmware update that changed EEPROM_VERSION,
+     * every section this build recognizes is restored over the defaults.
+     *
+     * Bump a section's version when its layout changes.
+     */
+    enum SectionTag : uint8_t {
+      SECTION_HOTEND_PID = 1,   // M301
+      SECTION_BED_PID,          // M304
+      SECTION_PROBE_OFFSET,     // M851
+      SECTION_HOME_OFFSET,      // M206
+      SECTION_BILINEAR,         // G29
+      SECTION_SHAPING,          // M593
+      SECTION_COUNT,
+      SECTION_END = 0xFF
+    };
+
+    typedef struct {
+      uint8_t tag, version;
+      uint16_t size, crc;
+    } section_header_t;
+
+    typedef union {
+      #if ENABLED(PIDTEMP)
+        raw_pidcf_t hotend_pid[HOTENDS];
+      #endif
+      #if ENABLED(PIDTEMPBED)
+        raw_pid_t bed_pid;
+      #endif
+      #if HAS_BED_PROBE
+        xyz_pos_t probe_offset;
+      #endif
+      #if HAS_HOME_OFFSET
+        xyz_pos_t home_offset;
+      #endif
+      #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+        struct {
+          uint8_t grid_max_x, grid_max_y;
+          xy_pos_t spacing, start;
+          bed_mesh_t z_values;
+        } bilinear;
+      #endif
+      #if HAS_SHAPING
+        float shaping[2][2];
+      #endif
+      uint8_t none;
+    } section_data_t;
+
+    #define SECTION_VERSION 1
+
+    // Get the current values for a section. Return the size, or 0 if not in this build.
+    static uint16_t section_get(const uint8_t tag, section_data_t &data) {
+      switch (tag) {
+        #if ENABLED(PIDTEMP)
+          case SECTION_HOTEND_PID:
+            HOTEND_LOOP() {
+              const hotend_pid_t &pid = thermalManager.temp_hotend[e].pid;
+              data.hotend_pid[e] = { pid.p(), pid.i(), pid.d(), pid.c(), pid.f() };
+            }
+            return sizeof(data.hotend_pid);
+        #endif
+        #if ENABLED(PIDTEMPBED)
+          case SECTION_BED_PID: {
+            const PID_t &pid = thermalManager.temp_bed.pid;
+            data.bed_pid = { pid.p(), pid.i(), pid.d() };
+          } return sizeof(data.bed_pid);
+        #endif
+        #if HAS_BED_PROBE
+          case SECTION_PROBE_OFFSET: data.probe_offset = probe.offset; return sizeof(data.probe_offset);
+        #endif
+        #if HAS_HOME_OFFSET
+          case SECTION_HOME_OFFSET: data.home_offset = home_offset; return sizeof(data.home_offset);
+        #endif
+        #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+          case SECTION_BILINEAR:
+            data.bilinear.grid_max_x = GRID_MAX_POINTS_X;
+            data.bilinear.grid_max_y = GRID_MAX_POINTS_Y;
+            data.bilinear.spacing = bedlevel.grid_spacing;
+            data.bilinear.start = bedlevel.grid_start;
+            COPY(data.bilinear.z_values, bedlevel.z_values);
+            return sizeof(data.bilinear);
+        #endif
+        #if HAS_SHAPING
+          case SECTION_SHAPING:
+            #if ENABLED(INPUT_SHAPING_X)
+              data.shaping[0][0] = stepper.get_shaping_frequency(X_AXIS);
+              data.shaping[0][1] = stepper.get_shaping_damping_ratio(X_AXIS);
+            #else
+              data.shaping[0][0] = data.shaping[0][1] = NAN;
+            #endif
+            #if ENABLED(INPUT_SHAPING_Y)
+              data.shaping[1][0] = stepper.get_shaping_frequency(Y_AXIS);
+              data.shaping[1][1] = stepper.get_shaping_damping_ratio(Y_AXIS);
+            #else
+              data.shaping[1][0] = data.shaping[1][1] = NAN;
+            #endif
+            return sizeof(data.shaping);
+        #endif
+        default: return 0;
+      }
+    }
+
+    // Apply the stored values of a section
+    static void section_set(const uint8_t tag, const section_data_t &data) {
+      switch (tag) {
+        #if ENABLED(PIDTEMP)
+          case SECTION_HOTEND_PID:
+            HOTEND_LOOP() if (!isnan(data.hotend_pid[e].p)) thermalManager.temp_hotend[e].pid.set(data.hotend_pid[e]);
+            break;
+        #endif
+        #if ENABLED(PIDTEMPBED)
+          case SECTION_BED_PID: if (!isnan(data.bed_pid.p)) thermalManager.temp_bed.pid.set(data.bed_pid); break;
+        #endif
+        #if HAS_BED_PROBE
+          case SECTION_PROBE_OFFSET: probe.offset = data.probe_offset; break;
+        #endif
+        #if HAS_HOME_OFFSET
+          case SECTION_HOME_OFFSET: home_offset = data.home_offset; break;
+        #endif
+        #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+          case SECTION_BILINEAR:
+            if (data.bilinear.grid_max_x == GRID_MAX_POINTS_X && data.bilinear.grid_max_y == GRID_MAX_POINTS_Y) {
+              bedlevel.set_grid(data.bilinear.spacing, data.bilinear.start);
+              COPY(bedlevel.z_values, data.bilinear.z_values);
+            }
+            break;
+        #endif
+        #if HAS_SHAPING
+          case SECTION_SHAPING:
+            #if ENABLED(INPUT_SHAPING_X)
+              if (!isnan(data.shaping[0][0])) {
+                stepper.set_shaping_frequency(X_AXIS, data.shaping[0][0]);
+                stepper.set_shaping_damping_ratio(X_AXIS, data.shaping[0][1]);
+              }
+            #endif
+            #if ENABLED(INPUT_SHAPING_Y)
+              if (!isnan(data.shaping[1][0])) {
+                stepper.set_shaping_frequency(Y_AXIS, data.shaping[1][0]);
+                stepper.set_shaping_damping_ratio(Y_AXIS, data.shaping[1][1]);
+              }
+            #endif
+            break;
+        #endif
+        default: break;
+      }
+    }
+
+    static int sections_start() { return persistentStore.capacity() - (EEPROM_SECTIONS_SIZE); }
+
+    // Write every section after the main settings. Unchanged bytes cost no writes.
+    void MarlinSettings::save_sections() {
+      if (EEPROM_OFFSET + datasize() > sections_start()) {
+        DEBUG_ERROR_MSG("No room for EEPROM_SECTIONS.");
+        return;
+      }
+      eeprom_index = sections_start();
+      for (uint8_t tag = 1; tag < SECTION_COUNT; tag++) {
+        section_data_t data;
+        section_header_t header = { tag, SECTION_VERSION, section_get(tag, data), 0 };
+        if (!header.size) continue;
+        crc16(&header.crc, &data, header.size);
+        EEPROM_WRITE(header);
+        persistentStore.write_data(eeprom_index, (const uint8_t*)&data, header.size, &working_crc);
+      }
+      const uint8_t end = SECTION_END;
+      EEPROM_WRITE(end);
+    }
+
+    // Restore the sections that match this build. Return the number restored.
+    uint8_t MarlinSettings::load_sections() {
+      uint8_t restored = 0;
+      if (!EEPROM_START(sections_start())) return 0;
+      const int end = persistentStore.capacity() - sizeof(section_header_t);
+      while (eeprom_index <= end) {
+        section_header_t header;
+        EEPROM_READ_ALWAYS(header);
+        if (header.tag == SECTION_END || header.size > persistentStore.capacity() - eeprom_index) break;
+        section_data_t data;
+        if (header.version == SECTION_VERSION && header.size <= sizeof(data) && header.size == section_get(header.tag, data)) {
+          persistentStore.read_data(eeprom_index, (uint8_t*)&data, header.size, &working_crc);
+          uint16_t crc = 0;
+          crc16(&crc, &data, header.size);
+          if (crc == header.crc) { section_set(header.tag, data); restored++; }
+        }
+        else
+          eeprom_index += header.size;
+      }
+      EEPROM_FINISH();
+      if (restored) DEBUG_ECHO_MSG("Calibration restored (", restored, " sections)");
+      return restored;
+    }
+
+  #endif // EEPROM_SECTIONS
+
   /**
    * M500 - Store Configuration
    */
@@ -1651,6 +1851,7 @@ void MarlinSettings::postprocess() {
 
       eeprom_error |= size_error(eeprom_size);
     }
+    TERN_(EEPROM_SECTIONS, if (!eeprom_error) save_sections());
     EEPROM_FINISH();
 
     //
@@ -2714,6 +2915,9 @@ void MarlinSettings::postprocess() {
       return success;
     }
     reset();
+    #if ENABLED(EEPROM_SECTIONS)
+      if (load_sections()) postprocess();
+    #endif
     #if EITHER(EEPROM_AUTO_INIT, EEPROM_INIT_NOW)
       (void)save();
       SERIAL_ECHO_MSG("EEPROM Initialized");
@@ -109,6 +109,11 @@ class MarlinSettings {
       static bool _load();
       static bool size_error(const uint16_t size);
 
+      #if ENABLED(EEPROM_SECTIONS)
+        static void save_sections();
+        static uint8_t load_sections();
+      #endif
+
       static int eeprom_index;
       static uint16_t working_crc;
 
@@ -35,6 +35,10 @@
 #include <HardwareSerial.h>
 #include <SPI.h>
 
+#if HAS_TMC_DMA_SERIAL
+  #include "../../HAL/STM32/tmc_serial_dma.h"
+#endif
+
 enum StealthIndex : uint8_t {
   LOGICAL_AXIS_LIST(STEALTH_AXIS_E, STEALTH_AXIS_X, STEALTH_AXIS_Y, STEALTH_AXIS_Z, STEALTH_AXIS_I, STEALTH_AXIS_J, STEALTH_AXIS_K, STEALTH_AXIS_U, STEALTH_AXIS_V, STEALTH_AXIS_W)
 };
@@ -56,7 +60,15 @@ enum StealthIndex : uint8_t {
 #else
   #define TMC_UART_HW_DEFINE(IC, ST, L, AI) TMCMarlin<IC##Stepper, L, AI> stepper##ST(&ST##_HARDWARE_SERIAL, float(ST##_RSENSE), ST##_SLAVE_ADDRESS)
 #endif
-#define TMC_UART_SW_DEFINE(IC, ST, L, AI) TMCMarlin<IC##Stepper, L, AI> stepper##ST(ST##_SERIAL_RX_PIN, ST##_SERIAL_TX_PIN, float(ST##_RSENSE), ST##_SLAVE_ADDRESS)
+#if HAS_TMC_DMA_SERIAL
+  // Single-wire drivers share the timer and DMA bus, with one port object per wire
+  #define TMC_UART_SW_DEFINE(IC, ST, L, AI) TMCSerialDMA ST##_serial_dma(ST##_SERIAL_TX_PIN); \
+                                            TMCMarlin<IC##Stepper, L, AI> stepper##ST(&ST##_serial_dma, float(ST##_RSENSE), ST##_SLAVE_ADDRESS)
+  #define SW_SERIAL_BEGIN(ST) ST##_serial_dma.begin(TMC_BAUD_RATE)
+#else
+  #define TMC_UART_SW_DEFINE(IC, ST, L, AI) TMCMarlin<IC##Stepper, L, AI> stepper##ST(ST##_SERIAL_RX_PIN, ST##_SERIAL_TX_PIN, float(ST##_RSENSE), ST##_SLAVE_ADDRESS)
+  #define SW_SERIAL_BEGIN(ST) stepper##ST.beginSerial(TMC_BAUD_RATE)
+#endif
 
 #define _TMC_SPI_DEFINE(IC, ST, AI) __TMC_SPI_DEFINE(IC, ST, TMC_##ST##_LABEL, AI)
 #define TMC_SPI_DEFINE(ST, AI) _TMC_SPI_DEFINE(ST##_DRIVER_TYPE, ST, AI##_AXIS)
@@ -514,154 +526,154 @@ enum StealthIndex : uint8_t {
       #ifdef X_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(X);
       #else
-        stepperX.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(X);
       #endif
     #endif
     #if AXIS_HAS_UART(X2)
       #ifdef X2_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(X2);
       #else
-        stepperX2.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(X2);
       #endif
     #endif
     #if AXIS_HAS_UART(Y)
       #ifdef Y_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(Y);
       #else
-        stepperY.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(Y);
       #endif
     #endif
     #if AXIS_HAS_UART(Y2)
       #ifdef Y2_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(Y2);
       #else
-        stepperY2.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(Y2);
       #endif
     #endif
     #if AXIS_HAS_UART(Z)
       #ifdef Z_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(Z);
       #else
-        stepperZ.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(Z);
       #endif
     #endif
     #if AXIS_HAS_UART(Z2)
       #ifdef Z2_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(Z2);
       #else
-        stepperZ2.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(Z2);
       #endif
     #endif
     #if AXIS_HAS_UART(Z3)
       #ifdef Z3_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(Z3);
       #else
-        stepperZ3.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(Z3);
       #endif
     #endif
     #if AXIS_HAS_UART(Z4)
       #ifdef Z4_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(Z4);
       #else
-        stepperZ4.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(Z4);
       #endif
     #endif
     #if AXIS_HAS_UART(I)
       #ifdef I_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(I);
       #else
-        stepperI.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(I);
       #endif
     #endif
     #if AXIS_HAS_UART(J)
       #ifdef J_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(J);
       #else
-        stepperJ.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(J);
       #endif
     #endif
     #if AXIS_HAS_UART(K)
       #ifdef K_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(K);
       #else
-        stepperK.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(K);
       #endif
     #endif
     #if AXIS_HAS_UART(U)
       #ifdef U_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(U);
       #else
-        stepperU.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(U);
       #endif
     #endif
     #if AXIS_HAS_UART(V)
       #ifdef V_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(V);
       #else
-        stepperV.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(V);
       #endif
     #endif
     #if AXIS_HAS_UART(W)
       #ifdef W_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(W);
       #else
-        stepperW.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(W);
       #endif
     #endif
     #if AXIS_HAS_UART(E0)
       #ifdef E0_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(E0);
       #else
-        stepperE0.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(E0);
       #endif
     #endif
     #if AXIS_HAS_UART(E1)
       #ifdef E1_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(E1);
       #else
-        stepperE1.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(E1);
       #endif
     #endif
     #if AXIS_HAS_UART(E2)
       #ifdef E2_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(E2);
       #else
-        stepperE2.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(E2);
       #endif
     #endif
     #if AXIS_HAS_UART(E3)
       #ifdef E3_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(E3);
       #else
-        stepperE3.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(E3);
       #endif
     #endif
     #if AXIS_HAS_UART(E4)
       #ifdef E4_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(E4);
       #else
-        stepperE4.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(E4);
       #endif
     #endif
     #if AXIS_HAS_UART(E5)
       #ifdef E5_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(E5);
       #else
-        stepperE5.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(E5);
       #endif
     #endif
     #if AXIS_HAS_UART(E6)
       #ifdef E6_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(E6);
       #else
-        stepperE6.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(E6);
       #endif
     #endif
     #if AXIS_HAS_UART(E7)
       #ifdef E7_HARDWARE_SERIAL
         HW_SERIAL_BEGIN(E7);
       #else
-        stepperE7.beginSerial(TMC_BAUD_RATE);
+        SW_SERIAL_BEGIN(E7);
       #endif
     #endif
   }
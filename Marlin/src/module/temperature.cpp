@@ -183,6 +183,10 @@
   #include "../feature/e_parser.h"
 #endif
 
+#if ENABLED(MATERIAL_GATE)
+  #include "../feature/material_gate.h"
+#endif
+
 #if ENABLED(PRINTER_EVENT_LEDS)
   #include "../feature/leds/printer_event_leds.h"
 #endif
@@ -439,7 +443,7 @@ PGMSTR(str_t_heating_failed, STR_T_HEATING_FAILED);
      */
     void Temperature::report_fan_speed(const uint8_t fan) {
       if (fan >= FAN_COUNT) return;
-      PORT_REDIRECT(SerialMask::All);
+      PORT_REDIRECT(SERIAL_CHANNEL_MASK(HOST));
       SERIAL_ECHOLNPGM("M106 P", fan, " S", fan_speed[fan]);
     }
   #endif
@@ -1272,9 +1276,12 @@ void Temperature::_temp_error(const heater_id_t heater_id, FSTR_P const serial_m
 
   static uint8_t killed = 0;
 
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
-  SERIAL_ECHOPGM("page error");
-  SERIAL_ECHOPGM("\xFF\xFF\xFF");
+  {
+    CHANNEL_REDIRECT(PANEL);
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+    SERIAL_ECHOPGM("page error");
+    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+  }
 
 
   if (IsRunning() && TERN1(BOGUS_TEMPERATURE_GRACE_PERIOD, killed == 2)) {
@@ -1282,9 +1289,12 @@ void Temperature::_temp_error(const heater_id_t heater_id, FSTR_P const serial_m
     SERIAL_ECHOF(serial_msg);
     SERIAL_ECHOPGM(STR_STOPPED_HEATER);
 
-    SERIAL_ECHOPGM("\xFF\xFF\xFF");
-    SERIAL_ECHOPGM("page error");
-    SERIAL_ECHOPGM("\xFF\xFF\xFF");
+    {
+      CHANNEL_REDIRECT(PANEL);
+      SERIAL_ECHOPGM("\xFF\xFF\xFF");
+      SERIAL_ECHOPGM("page error");
+      SERIAL_ECHOPGM("\xFF\xFF\xFF");
+    }
 
     heater_id_t real_heater_id = heater_id;
 
@@ -1568,7 +1578,13 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
 
       #if ENABLED(THERMAL_PROTECTION_HOTENDS)
         // Check for thermal runaway
-        tr_state_machine[e].run(temp_hotend[e].celsius, temp_hotend[e].target, (heater_id_t)e, THERMAL_PROTECTION_PERIOD, THERMAL_PROTECTION_HYSTERESIS);
+        #if ENABLED(THERMAL_PROTECTION_MODEL)
+          // The PERIOD / HYSTERESIS check stands in until the model is calibrated
+          TERN_(MPCTEMP, tr_model[e].from_mpc(temp_hotend[e].constants));
+          if (!tr_model[e].run(temp_hotend[e].celsius, temp_hotend[e].target, temp_hotend[e].soft_pwm_amount, TR_MODEL_HOTEND_MAX, (heater_id_t)e,
+                               TR_MODEL_AMBIENT, THERMAL_MODEL_HOTEND_LIMIT))
+        #endif
+          tr_state_machine[e].run(temp_hotend[e].celsius, temp_hotend[e].target, (heater_id_t)e, THERMAL_PROTECTION_PERIOD, THERMAL_PROTECTION_HYSTERESIS);
       #endif
 
       temp_hotend[e].soft_pwm_amount = (temp_hotend[e].celsius > temp_range[e].mintemp || is_preheating(e)) && temp_hotend[e].celsius < temp_range[e].maxtemp ? (int)get_pid_output_hotend(e) >> 1 : 0;
@@ -1631,7 +1647,11 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
       TERN_(HEATER_IDLE_HANDLER, heater_idle[IDLE_INDEX_BED].update(ms));
 
       #if ENABLED(THERMAL_PROTECTION_BED)
-        tr_state_machine[RUNAWAY_IND_BED].run(temp_bed.celsius, temp_bed.target, H_BED, THERMAL_PROTECTION_BED_PERIOD, THERMAL_PROTECTION_BED_HYSTERESIS);
+        #if ENABLED(THERMAL_PROTECTION_MODEL)
+          if (!tr_model[RUNAWAY_IND_BED].run(temp_bed.celsius, temp_bed.target, temp_bed.soft_pwm_amount, MAX_BED_POWER >> 1, H_BED,
+                                             TR_MODEL_AMBIENT, THERMAL_MODEL_BED_LIMIT))
+        #endif
+          tr_state_machine[RUNAWAY_IND_BED].run(temp_bed.celsius, temp_bed.target, H_BED, THERMAL_PROTECTION_BED_PERIOD, THERMAL_PROTECTION_BED_HYSTERESIS);
       #endif
 
       #if HEATER_IDLE_HANDLER
@@ -1788,7 +1808,11 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
         }
      }
      #if ENABLED(THERMAL_PROTECTION_CHAMBER)
-       tr_state_machine[RUNAWAY_IND_CHAMBER].run(temp_chamber.celsius, temp_chamber.target, H_CHAMBER, THERMAL_PROTECTION_CHAMBER_PERIOD, THERMAL_PROTECTION_CHAMBER_HYSTERESIS);
+       #if ENABLED(THERMAL_PROTECTION_MODEL)
+         if (!tr_model[RUNAWAY_IND_CHAMBER].run(temp_chamber.celsius, temp_chamber.target, temp_chamber.soft_pwm_amount, (MAX_CHAMBER_POWER) >> 1, H_CHAMBER,
+                                                THERMAL_MODEL_AMBIENT, THERMAL_MODEL_CHAMBER_LIMIT))
+       #endif
+         tr_state_machine[RUNAWAY_IND_CHAMBER].run(temp_chamber.celsius, temp_chamber.target, H_CHAMBER, THERMAL_PROTECTION_CHAMBER_PERIOD, THERMAL_PROTECTION_CHAMBER_HYSTERESIS);
      #endif
    #endif
   }
@@ -1853,7 +1877,11 @@ void Temperature::min_temp_error(const heater_id_t heater_id) {
     }
 
     #if ENABLED(THERMAL_PROTECTION_COOLER)
-      tr_state_machine[RUNAWAY_IND_COOLER].run(temp_cooler.celsius, temp_cooler.target, H_COOLER, THERMAL_PROTECTION_COOLER_PERIOD, THERMAL_PROTECTION_COOLER_HYSTERESIS);
+      #if ENABLED(THERMAL_PROTECTION_MODEL)
+        if (!tr_model[RUNAWAY_IND_COOLER].run(temp_cooler.celsius, temp_cooler.target, temp_cooler.soft_pwm_amount >> 1, (MAX_COOLER_POWER) >> 1, H_COOLER,
+                                              THERMAL_MODEL_AMBIENT, THERMAL_MODEL_COOLER_LIMIT))
+      #endif
+        tr_state_machine[RUNAWAY_IND_COOLER].run(temp_cooler.celsius, temp_cooler.target, H_COOLER, THERMAL_PROTECTION_COOLER_PERIOD, THERMAL_PROTECTION_COOLER_HYSTERESIS);
     #endif
   }
 
@@ -1890,10 +1918,14 @@ void Temperature::task() {
         gcode.process_subcommands_now(F("M524"));
       }
     #endif
+
+    TERN_(EMERGENCY_OVERRIDES, emergency_parser.apply_overrides());
   #endif
 
   if (!updateTemperaturesIfReady()) return; // Will also reset the watchdog if temperatures are ready
 
+  TERN_(MATERIAL_GATE, material_gate.task());
+
   #if DISABLED(IGNORE_THERMOCOUPLE_ERRORS)
     #if TEMP_SENSOR_IS_MAX_TC(0)
       if (degHotend(0) > _MIN(HEATER_0_MAXTEMP, TEMP_SENSOR_0_MAX_TC_TMAX - 1.0)) max_temp_error(H_E0);
@@ -2631,6 +2663,8 @@ void Temperature::init() {
     OUT_WRITE(COOLER_PIN, COOLER_INVERTING);
   #endif
 
+  TERN_(HEATER_HARDWARE_PWM, init_hardware_pwm());
+
   #if HAS_FAN0
     INIT_FAN_PIN(FAN_PIN);
   #endif
@@ -2964,6 +2998,135 @@ void Temperature::init() {
 
   #pragma GCC diagnostic pop
 
+  #if ENABLED(THERMAL_PROTECTION_MODEL)
+
+    Temperature::tr_model_t Temperature::tr_model[NR_HEATER_RUNAWAY];
+
+    /**
+     * @brief Learn the model constants of a heater from normal operation
+     * @param current     current measured temperature
+     * @param target      current target temperature (0 = heater off)
+     * @param duty        heater power applied since the last update (0-127)
+     * @param max_duty    largest power the controller applies
+     * @param heater_id   heater being calibrated
+     * @param ambient     temperature the heater settles at with no power
+     *
+     * The heating rate is measured in 10s windows while the heater runs at full power
+     * well away from the target, keeping the last window before the target is reached.
+     * Once the temperature has held within 1°C of the target for a minute, the average
+     * duty of the hold gives the full-power rise (GAIN), and the heating rate gives the
+     * time constant (TAU) from dT/dt = (ambient + GAIN - T) / TAU. Implausible results
+     * are dropped and the next heat-up is tried again.
+     */
+    void Temperature::tr_model_t::calibrate(const_celsius_float_t current, const celsius_t target, const uint8_t duty, const uint8_t max_duty,
+      const heater_id_t heater_id, const_celsius_float_t ambient
+    ) {
+      constexpr millis_t rise_window_ms = SEC_TO_MS(10), hold_window_ms = SEC_TO_MS(60);
+
+      if (!target) { rise_ms = hold_ms = 0; return; }
+
+      const millis_t now = millis();
+
+      if (duty >= max_duty && ABS(current - target) > 10) {
+        if (!rise_ms) { rise_ms = now; rise_temp = current; }
+        else if (ELAPSED(now, rise_ms + rise_window_ms)) {
+          rise_rate = (current - rise_temp) * 1000.0f / float(now - rise_ms);
+          rise_mid = (current + rise_temp) * 0.5f;
+          rise_ms = now;
+          rise_temp = current;
+        }
+      }
+      else
+        rise_ms = 0;
+
+      if (ABS(current - target) > 1) { hold_ms = 0; return; }
+
+      if (!hold_ms) { hold_ms = now; duty_sum = duty_count = 0; }
+      duty_sum += duty;
+      duty_count++;
+      if (!ELAPSED(now, hold_ms + hold_window_ms)) return;
+      hold_ms = 0;
+      if (!duty_sum || NEAR_ZERO(rise_rate)) return;
+
+      const float gain = (target - ambient) * 127.0f * duty_count / duty_sum,
+                  tau = (ambient + gain * max_duty / 127.0f - rise_mid) / rise_rate;
+      if (!WITHIN(ABS(gain), 5, 2000) || !WITHIN(tau, 1, 3600)) return;
+
+      gain_degc = int16_t(gain);
+      tau_s = uint16_t(tau);
+      last_ms = 0;  // Start the model from the sensor
+      SERIAL_ECHOLNPGM("Thermal model H", int(heater_id), " gain:", gain_degc, " tau:", tau_s);
+    }
+
+    /**
+     * @brief Model-based Thermal Protection for a single heater
+     * @param current     current measured temperature
+     * @param target      current target temperature (0 = heater off)
+     * @param duty        heater power applied since the last update (0-127)
+     * @param max_duty    largest power the controller applies
+     * @param heater_id   heater being checked
+     * @param ambient     temperature the heater settles at with no power
+     * @param limit_degc  largest residual allowed between the model and the sensor
+     * @return false while the model is still being calibrated, so the caller
+     *         falls back to the PERIOD / HYSTERESIS state machine
+     *
+     * The model advances one Euler step toward the steady state for the applied power,
+     * and the residual (sensor minus model) is checked. A fraction of the residual is
+     * then fed back so slow modeling errors fade out but sudden departures don't.
+     * Nothing is fed back while the residual is over the limit, so it can't be pulled
+     * back under before the trip time runs out. While the duty is saturated the
+     * controller can no longer correct a failed heater or a detached sensor, so the
+     * model only follows a residual under half the limit, enough to absorb the error
+     * of a long heat-up or a bang-bang cycle without hiding a real fault.
+     * The sensor and ambient readings are converted to fixed point once. The model
+     * itself is integer math, with a single 64-bit multiply-divide per term.
+     */
+    bool Temperature::tr_model_t::run(const_celsius_float_t current, const celsius_t target, const uint8_t duty, const uint8_t max_duty,
+      const heater_id_t heater_id, const_celsius_float_t ambient, const uint8_t limit_degc
+    ) {
+      constexpr int32_t track_q16 = int32_t((THERMAL_MODEL_TRACKING) * 65536.0f);
+
+      if (!calibrated()) {
+        calibrate(current, target, duty, max_duty, heater_id, ambient);
+        return false;
+      }
+
+      const millis_t now = millis();
+      const int32_t measured = int32_t(current * 256);
+
+      // Idle heaters just follow the sensor, so the model starts from the real temperature
+      if (!target || !last_ms) {
+        modeled = measured;
+        last_ms = now;
+        trip_ms = 0;
+        return true;
+      }
+
+      const int32_t dt = int32_t(now - last_ms);
+      if (dt <= 0) return true;
+      last_ms = now;
+
+      // Steady-state temperature for the applied power, then a step toward it
+      const int32_t steady = int32_t(ambient * 256) + (int32_t(gain_degc) * 256 * duty) / 127;
+      modeled += int32_t(int64_t(steady - modeled) * dt / (int32_t(tau_s) * 1000));
+
+      const int32_t residual = measured - modeled, limit = int32_t(limit_degc) * 256;
+      if (ABS(residual) <= limit) {
+        if ((duty && duty < max_duty) || ABS(residual) <= limit / 2)
+          modeled += int32_t((int64_t(residual) * dt * track_q16 / 1000) >> 16);
+        trip_ms = 0;
+      }
+      else if (!trip_ms)
+        trip_ms = now + (THERMAL_MODEL_TRIP_TIME);
+      else if (ELAPSED(now, trip_ms)) {
+        TERN_(HAS_DWIN_E3V2_BASIC, DWIN_Popup_Temperature(0));
+        _temp_error(heater_id, FPSTR(str_t_thermal_runaway), GET_TEXT_F(MSG_THERMAL_RUNAWAY));
+      }
+      return true;
+    }
+
+  #endif // THERMAL_PROTECTION_MODEL
+
 #endif // HAS_THERMAL_PROTECTION
 
 void Temperature::disable_all_heaters() {
@@ -3001,8 +3164,54 @@ void Temperature::disable_all_heaters() {
     temp_cooler.soft_pwm_amount = 0;
     WRITE_HEATER_COOLER(LOW);
   #endif
+
+  TERN_(HEATER_HARDWARE_PWM, update_hardware_pwm());
 }
 
+#if ENABLED(HEATER_HARDWARE_PWM)
+
+  /**
+   * Hand each heater with a usable timer channel over to the timer.
+   * The timer is set up here, once, so the ISR only has to write the compare register.
+   */
+  void Temperature::init_hardware_pwm() {
+    #define _HW_PWM_INIT(H,P,I) do{                           \
+      H.hw_pwm_ccr = nullptr;                                 \
+      if (hal.pwm_timer_available(P)) {                       \
+        hal.set_pwm_frequency(P, HEATER_PWM_FREQUENCY);       \
+        hal.set_pwm_duty(P, 0, 255, I);                       \
+        hal.get_pwm_registers(P, H.hw_pwm_ccr, H.hw_pwm_arr); \
+      }                                                       \
+    }while(0)
+
+    #if HAS_HOTEND
+      #define _HW_PWM_INIT_E(N) _HW_PWM_INIT(temp_hotend[N], HEATER_##N##_PIN, HEATER_##N##_INVERTING);
+      REPEAT(HOTENDS, _HW_PWM_INIT_E);
+    #endif
+    TERN_(HAS_HEATED_BED, _HW_PWM_INIT(temp_bed, HEATER_BED_PIN, HEATER_BED_INVERTING));
+    TERN_(HAS_HEATED_CHAMBER, _HW_PWM_INIT(temp_chamber, HEATER_CHAMBER_PIN, HEATER_CHAMBER_INVERTING));
+  }
+
+  // Apply soft_pwm_amount (0-127) to the timers. A single register write each, safe in the ISR.
+  void Temperature::update_hardware_pwm() {
+    #define _HW_PWM_SET(H,I) do{                            \
+      if (H.hw_pwm_ccr) {                                   \
+        const uint32_t top = *H.hw_pwm_arr + 1;             \
+        const uint32_t ccr = top * H.soft_pwm_amount / 127; \
+        *H.hw_pwm_ccr = (I) ? top - ccr : ccr;              \
+      }                                                     \
+    }while(0)
+
+    #if HAS_HOTEND
+      #define _HW_PWM_SET_E(N) _HW_PWM_SET(temp_hotend[N], HEATER_##N##_INVERTING);
+      REPEAT(HOTENDS, _HW_PWM_SET_E);
+    #endif
+    TERN_(HAS_HEATED_BED, _HW_PWM_SET(temp_bed, HEATER_BED_INVERTING));
+    TERN_(HAS_HEATED_CHAMBER, _HW_PWM_SET(temp_chamber, HEATER_CHAMBER_INVERTING));
+  }
+
+#endif // HEATER_HARDWARE_PWM
+
 #if ENABLED(PRINTJOB_TIMER_AUTOSTART)
 
   bool Temperature::auto_job_over_threshold() {
@@ -3416,9 +3625,10 @@ void Temperature::isr() {
 
     #if ANY(HAS_HOTEND, HAS_HEATED_BED, HAS_HEATED_CHAMBER, HAS_COOLER, FAN_SOFT_PWM)
       constexpr uint8_t pwm_mask = TERN0(SOFT_PWM_DITHER, _BV(SOFT_PWM_SCALE) - 1);
-      #define _PWM_MOD(N,S,T) do{                           \
-        const bool on = S.add(pwm_mask, T.soft_pwm_amount); \
-        WRITE_HEATER_##N(on);                               \
+      #define _PWM_MOD(N,S,T) do{                            \
+        if (TERN0(HEATER_HARDWARE_PWM, T.hw_pwm_ccr)) break; \
+        const bool on = S.add(pwm_mask, T.soft_pwm_amount);  \
+        WRITE_HEATER_##N(on);                                \
       }while(0)
     #endif
 
@@ -3428,6 +3638,8 @@ void Temperature::isr() {
     if (pwm_count_tmp >= 127) {
       pwm_count_tmp -= 127;
 
+      TERN_(HEATER_HARDWARE_PWM, update_hardware_pwm());
+
       #if HAS_HOTEND
         #define _PWM_MOD_E(N) _PWM_MOD(N,soft_pwm_hotend[N],temp_hotend[N]);
         REPEAT(HOTENDS, _PWM_MOD_E);
@@ -3484,22 +3696,22 @@ void Temperature::isr() {
       #endif
     }
     else {
-      #define _PWM_LOW(N,S) do{ if (S.count <= pwm_count_tmp) WRITE_HEATER_##N(LOW); }while(0)
+      #define _PWM_LOW(N,S,T) do{ if (!TERN0(HEATER_HARDWARE_PWM, T.hw_pwm_ccr) && S.count <= pwm_count_tmp) WRITE_HEATER_##N(LOW); }while(0)
       #if HAS_HOTEND
-        #define _PWM_LOW_E(N) _PWM_LOW(N, soft_pwm_hotend[N]);
+        #define _PWM_LOW_E(N) _PWM_LOW(N, soft_pwm_hotend[N], temp_hotend[N]);
         REPEAT(HOTENDS, _PWM_LOW_E);
       #endif
 
       #if HAS_HEATED_BED
-        _PWM_LOW(BED, soft_pwm_bed);
+        _PWM_LOW(BED, soft_pwm_bed, temp_bed);
       #endif
 
       #if HAS_HEATED_CHAMBER
-        _PWM_LOW(CHAMBER, soft_pwm_chamber);
+        _PWM_LOW(CHAMBER, soft_pwm_chamber, temp_chamber);
       #endif
 
       #if HAS_COOLER
-        _PWM_LOW(COOLER, soft_pwm_cooler);
+        _PWM_LOW(COOLER, soft_pwm_cooler, temp_cooler);
       #endif
 
       #if ENABLED(FAN_SOFT_PWM)
@@ -3969,16 +4181,6 @@ void Temperature::isr() {
       SERIAL_PRINT(c, SFP);
       SERIAL_ECHOPGM("\"");
       SERIAL_ECHOPGM("\xFF\xFF\xFF");
-      if(c<=18.00){
-        SERIAL_ECHOPGM("\xFF\xFF\xFF");
-        SERIAL_ECHOPGM("ilksayfa.can.val=1");
-        SERIAL_ECHOPGM("\xFF\xFF\xFF");
-      }
-      else{
-        SERIAL_ECHOPGM("\xFF\xFF\xFF");
-        SERIAL_ECHOPGM("ilksayfa.can.val=0");
-        SERIAL_ECHOPGM("\xFF\xFF\xFF");
-      }
    }
 
     //SERIAL_ECHOPGM(" /");
@@ -4044,6 +4246,7 @@ void Temperature::isr() {
   void Temperature::print_heater_states(const int8_t target_extruder
     OPTARG(HAS_TEMP_REDUNDANT, const bool include_r/*=false*/)
   ) {
+    CHANNEL_REDIRECT(PANEL);
     #if HAS_TEMP_HOTEND
       print_heater_state(H_NONE, degHotend(target_extruder), degTargetHotend(target_extruder) OPTARG(SHOW_TEMP_ADC_VALUES, rawHotendTemp(target_extruder)));
     #endif
@@ -299,6 +299,10 @@ public:
 typedef struct HeaterInfo : public TempInfo {
   celsius_t target;
   uint8_t soft_pwm_amount;
+  #if ENABLED(HEATER_HARDWARE_PWM)
+    volatile uint32_t *hw_pwm_ccr,  // Timer compare register driving the heater (nullptr = software PWM)
+                      *hw_pwm_arr;  // Timer auto-reload register (period - 1)
+  #endif
   bool is_below_target(const celsius_t offs=0) const { return (celsius < (target + offs)); }
 } heater_info_t;
 
@@ -1134,6 +1138,11 @@ class Temperature {
       static float get_pid_output_chamber();
     #endif
 
+    #if ENABLED(HEATER_HARDWARE_PWM)
+      static void init_hardware_pwm();
+      static void update_hardware_pwm();
+    #endif
+
     static void _temp_error(const heater_id_t e, FSTR_P const serial_msg, FSTR_P const lcd_msg);
     static void min_temp_error(const heater_id_t e);
     static void max_temp_error(const heater_id_t e);
@@ -1181,6 +1190,48 @@ class Temperature {
 
       static tr_state_machine_t tr_state_machine[NR_HEATER_RUNAWAY];
 
+      #if ENABLED(THERMAL_PROTECTION_MODEL)
+
+        // First-order heater model in fixed point (°C * 256), checked against the sensor
+        typedef struct {
+          int32_t modeled = 0;      // Predicted temperature
+          millis_t last_ms = 0,     // Time of the previous update
+                   trip_ms = 0;     // Time at which an out-of-limit residual trips (0 = within limit)
+          int16_t gain_degc = 0;    // Rise above ambient the heater settles at with full power
+          uint16_t tau_s = 0;       // Time constant of the heater in seconds (0 = not calibrated)
+
+          // Calibration from a full-power heat-up followed by a hold at the target
+          millis_t rise_ms = 0,     // Start of the current full-power window (0 = none)
+                   hold_ms = 0;     // Start of the current hold at the target (0 = none)
+          celsius_float_t rise_temp = 0; // Temperature at the start of the full-power window
+          float rise_rate = 0,      // Full-power heating rate (°C/s) over the last window
+                rise_mid = 0;       // Temperature halfway through that window
+          uint32_t duty_sum = 0, duty_count = 0; // Power applied during the hold
+
+          bool calibrated() const { return tau_s != 0; }
+
+          #if ENABLED(MPCTEMP)
+            // The MPC block model already gives the full-power rise and the time constant
+            void from_mpc(const MPC_t &c) {
+              if (c.ambient_xfer_coeff_fan0 <= 0) return;
+              gain_degc = int16_t(_MIN(c.heater_power / c.ambient_xfer_coeff_fan0, 2000.0f));
+              tau_s = uint16_t(constrain(c.block_heat_capacity / c.ambient_xfer_coeff_fan0, 1.0f, 3600.0f));
+            }
+          #endif
+
+          void calibrate(const_celsius_float_t current, const celsius_t target, const uint8_t duty, const uint8_t max_duty,
+                         const heater_id_t heater_id, const_celsius_float_t ambient);
+          bool run(const_celsius_float_t current, const celsius_t target, const uint8_t duty, const uint8_t max_duty,
+                   const heater_id_t heater_id, const_celsius_float_t ambient, const uint8_t limit_degc);
+        } tr_model_t;
+
+        static tr_model_t tr_model[NR_HEATER_RUNAWAY];
+
+        #define TR_MODEL_AMBIENT TERN(HAS_TEMP_CHAMBER, degChamber(), THERMAL_MODEL_AMBIENT)
+        #define TR_MODEL_HOTEND_MAX (TERN(MPCTEMP, MPC_MAX, TERN(PIDTEMP, PID_MAX, BANG_MAX)) >> 1)
+
+      #endif
+
     #endif // HAS_THERMAL_PROTECTION
 };
 
@@ -109,7 +109,9 @@
   #define E1_SERIAL_RX_PIN      E1_SERIAL_TX_PIN
 
   // Reduce baud rate to improve software serial reliability
-  #define TMC_BAUD_RATE                    19200
+  #if DISABLED(TMC_SERIAL_DMA)
+    #define TMC_BAUD_RATE                  19200
+  #endif
 #endif
 
 //
@@ -938,6 +938,7 @@ bool SdBaseFile::openCachedEntry(uint8_t dirIndex, uint8_t oflag) {
   // set to start of file
   curCluster_ = 0;
   curPosition_ = 0;
+  forgetClusterRun();
   if ((oflag & O_TRUNC) && !truncate(0)) return false;
   return oflag & O_AT_END ? seekEnd(0) : true;
 
@@ -1259,6 +1260,7 @@ bool SdBaseFile::openRoot(SdVolume *vol) {
 
   // set to start of file
   curCluster_ = curPosition_ = 0;
+  forgetClusterRun();
 
   // root has no directory entry
   dirBlock_ = dirIndex_ = 0;
@@ -1367,6 +1369,7 @@ int16_t SdBaseFile::read(void *buf, uint16_t nbyte) {
   uint8_t *dst = reinterpret_cast<uint8_t*>(buf);
   uint16_t offset, toRead;
   uint32_t block;  // raw device block number
+  uint8_t blocksLeft;  // blocks from here to the end of the cluster
 
   // error if not open or write only
   if (!isOpen() || !(flags_ & O_READ)) return -1;
@@ -1380,14 +1383,16 @@ int16_t SdBaseFile::read(void *buf, uint16_t nbyte) {
     offset = curPosition_ & 0x1FF;  // offset in block
     if (type_ == FAT_FILE_TYPE_ROOT_FIXED) {
       block = vol_->rootDirStart() + (curPosition_ >> 9);
+      blocksLeft = 1;
     }
     else {
       uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
+      blocksLeft = vol_->blocksPerCluster() - blockOfCluster;
       if (offset == 0 && blockOfCluster == 0) {
         // start of new cluster
         if (curPosition_ == 0)
           curCluster_ = firstCluster_;                      // use first cluster in file
-        else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
+        else if (!nextCluster())                            // get next cluster from FAT
           return -1;
       }
       block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
@@ -1399,7 +1404,13 @@ int16_t SdBaseFile::read(void *buf, uint16_t nbyte) {
 
     // no buffering needed if n == 512
     if (n == 512 && block != vol_->cacheBlockNumber()) {
-      if (!vol_->readBlock(block, dst)) return -1;
+      // read whole blocks to the end of the cluster in one transfer,
+      // stopping short of a block that may be newer in the cache
+      uint16_t count = _MIN(toRead >> 9, blocksLeft);
+      const uint32_t cached = vol_->cacheBlockNumber();
+      if (cached > block && cached < block + count) count = cached - block;
+      if (!vol_->readBlocks(block, dst, count)) return -1;
+      n = count << 9;
     }
     else {
       // read block to cache and copy data to caller
@@ -1900,12 +1911,32 @@ bool SdBaseFile::seekSet(const uint32_t pos) {
     nNew -= nCur;                     // advance from curPosition
 
   while (nNew--)
-    if (!vol_->fatGet(curCluster_, &curCluster_)) return false;
+    if (!nextCluster()) return false;
 
   curPosition_ = pos;
   return true;
 }
 
+/**
+ * Step curCluster_ to the next cluster in the file's chain. Within a known
+ * run of contiguous clusters the FAT isn't read at all.
+ *
+ * \return true for success, false for failure.
+ */
+bool SdBaseFile::nextCluster() {
+  #if ENABLED(SD_CLUSTER_RUNS)
+    if (curCluster_ < runStart_ || curCluster_ >= runEnd_) {
+      runStart_ = curCluster_;
+      if (!vol_->fatRunEnd(curCluster_, &runEnd_)) return false;
+    }
+    if (curCluster_ < runEnd_) {
+      curCluster_++;
+      return true;
+    }
+  #endif
+  return vol_->fatGet(curCluster_, &curCluster_);
+}
+
 void SdBaseFile::setpos(filepos_t *pos) {
   curPosition_ = pos->position;
   curCluster_ = pos->cluster;
@@ -2089,6 +2120,7 @@ bool SdBaseFile::truncate(uint32_t length) {
 
   // position to last cluster in truncated file
   if (!seekSet(length)) return false;
+  forgetClusterRun();
 
   if (length == 0) {
     // free all clusters
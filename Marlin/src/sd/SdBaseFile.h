@@ -365,6 +365,10 @@ class SdBaseFile {
   uint32_t  fileSize_;      // file size in bytes
   uint32_t  firstCluster_;  // first cluster of file
   SdVolume  *vol_;          // volume where file is located
+  #if ENABLED(SD_CLUSTER_RUNS)
+    uint32_t runStart_;     // first cluster of a known contiguous run
+    uint32_t runEnd_;       // last cluster of the run
+  #endif
 
   /**
    * EXPERIMENTAL - Don't use!
@@ -376,6 +380,8 @@ class SdBaseFile {
   bool addDirCluster();
   dir_t* cacheDirEntry(uint8_t action);
   int8_t lsPrintNext(uint8_t flags, uint8_t indent);
+  bool nextCluster();
+  void forgetClusterRun() { TERN_(SD_CLUSTER_RUNS, runStart_ = runEnd_ = 0); }
   static bool make83Name(const char *str, uint8_t *name, const char **ptr);
   bool mkdir(SdBaseFile *parent, const uint8_t dname[11]
     OPTARG(LONG_FILENAME_WRITE_SUPPORT, const uint8_t dlname[LONG_FILENAME_LENGTH])
@@ -44,6 +44,10 @@
   DiskIODriver *SdVolume::sdCard_;       // pointer to SD card object
   bool     SdVolume::cacheDirty_;        // cacheFlush() will write block if true
   uint32_t SdVolume::cacheMirrorBlock_;  // mirror  block for second FAT
+  #if SD_FAT_CACHE_BLOCKS
+    fat_cache_t SdVolume::fatCache_[SD_FAT_CACHE_BLOCKS];
+    uint32_t SdVolume::fatCacheClock_;
+  #endif
 #endif
 
 // find a contiguous group of clusters
@@ -78,6 +82,11 @@ bool SdVolume::allocContiguous(uint32_t count, uint32_t *curCluster) {
   // end of group
   endCluster = bgnCluster;
 
+  #if ENABLED(SD_FREE_CLUSTER_MAP)
+    // set while a map group has been read from its start without a free cluster
+    bool groupFull = false;
+  #endif
+
   // search the FAT for free clusters
   for (uint32_t n = 0;; n++, endCluster++) {
     // can't find space checked all clusters
@@ -87,16 +96,39 @@ bool SdVolume::allocContiguous(uint32_t count, uint32_t *curCluster) {
     if (endCluster > fatEnd) {
       bgnCluster = endCluster = 2;
     }
+
+    #if ENABLED(SD_FREE_CLUSTER_MAP)
+      if (freeMapShift_) {
+        // skip a group of FAT blocks known to be full
+        if (!freeMapHolds(endCluster)) {
+          const uint32_t groupEnd = freeMapGroupEnd(endCluster);
+          n += groupEnd - endCluster;
+          endCluster = groupEnd;
+          bgnCluster = endCluster + 1;
+          continue;
+        }
+        if (endCluster == 2 || !(endCluster & ((uint32_t(1) << freeMapShift_) - 1))) groupFull = true;
+      }
+    #endif
+
     uint32_t f;
     if (!fatGet(endCluster, &f)) return false;
 
     if (f != 0) {
       // cluster in use try next cluster as bgnCluster
       bgnCluster = endCluster + 1;
+      #if ENABLED(SD_FREE_CLUSTER_MAP)
+        // a whole group read without a free cluster can be skipped next time
+        if (groupFull && endCluster == freeMapGroupEnd(endCluster)) {
+          freeMapMark(endCluster, false);
+          groupFull = false;
+        }
+      #endif
     }
-    else if ((endCluster - bgnCluster + 1) == count) {
+    else {
+      TERN_(SD_FREE_CLUSTER_MAP, groupFull = false);
       // done - found space
-      break;
+      if ((endCluster - bgnCluster + 1) == count) break;
     }
   }
   // mark end of chain
@@ -134,10 +166,73 @@ bool SdVolume::cacheFlush() {
       }
       cacheDirty_ = 0;
     }
+    #if SD_FAT_CACHE_BLOCKS
+      for (fat_cache_t &fc : fatCache_)
+        if (!fatCacheWrite(fc)) return false;
+    #endif
   #endif
   return true;
 }
 
+#if SD_FAT_CACHE_BLOCKS
+
+  // Write a dirty FAT cache block and its mirror
+  bool SdVolume::fatCacheWrite(fat_cache_t &fc) {
+    #if DISABLED(SDCARD_READONLY)
+      if (fc.dirty) {
+        if (!sdCard_->writeBlock(fc.blockNumber, fc.buffer.data)) return false;
+        if (fc.mirrorBlock) {
+          if (!sdCard_->writeBlock(fc.mirrorBlock, fc.buffer.data)) return false;
+          fc.mirrorBlock = 0;
+        }
+        fc.dirty = false;
+      }
+    #endif
+    return true;
+  }
+
+#endif
+
+/**
+ * Get a block of the first FAT into a cache. With SD_FAT_CACHE_BLOCKS the
+ * block is kept apart from the file data cache, replacing the least recently
+ * used FAT block. A block cached for write is also written to the second FAT.
+ *
+ * \return A pointer to the cached block or nullptr if an I/O error occurs.
+ */
+cache_t* SdVolume::cacheFatBlock(uint32_t blockNumber, bool dirty) {
+  const uint32_t mirrorBlock = (dirty && fatCount_ > 1) ? blockNumber + blocksPerFat_ : 0;
+
+  #if SD_FAT_CACHE_BLOCKS
+
+    fat_cache_t *fc = nullptr, *lru = &fatCache_[0];
+    for (fat_cache_t &c : fatCache_) {
+      if (c.blockNumber == blockNumber) { fc = &c; break; }
+      if (c.lastUse < lru->lastUse) lru = &c;
+    }
+
+    if (!fc) {
+      if (!fatCacheWrite(*lru)) return nullptr;
+      lru->blockNumber = 0xFFFFFFFF;
+      if (!sdCard_->readBlock(blockNumber, lru->buffer.data)) return nullptr;
+      lru->blockNumber = blockNumber;
+      fc = lru;
+    }
+
+    fc->lastUse = ++fatCacheClock_;
+    if (dirty) fc->dirty = true;
+    if (mirrorBlock) fc->mirrorBlock = mirrorBlock;
+    return &fc->buffer;
+
+  #else
+
+    if (!cacheRawBlock(blockNumber, dirty)) return nullptr;
+    if (mirrorBlock) cacheMirrorBlock_ = mirrorBlock;
+    return &cacheBuffer_;
+
+  #endif
+}
+
 bool SdVolume::cacheRawBlock(uint32_t blockNumber, bool dirty) {
   if (cacheBlockNumber_ != blockNumber) {
     if (!cacheFlush()) return false;
@@ -167,15 +262,16 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t *value) {
     uint16_t index = cluster;
     index += index >> 1;
     lba = fatStartBlock_ + (index >> 9);
-    if (!cacheRawBlock(lba, CACHE_FOR_READ)) return false;
+    cache_t *fc = cacheFatBlock(lba, CACHE_FOR_READ);
+    if (!fc) return false;
     index &= 0x1FF;
-    uint16_t tmp = cacheBuffer_.data[index];
+    uint16_t tmp = fc->data[index];
     index++;
     if (index == 512) {
-      if (!cacheRawBlock(lba + 1, CACHE_FOR_READ)) return false;
+      if (!(fc = cacheFatBlock(lba + 1, CACHE_FOR_READ))) return false;
       index = 0;
     }
-    tmp |= cacheBuffer_.data[index] << 8;
+    tmp |= fc->data[index] << 8;
     *value = cluster & 1 ? tmp >> 4 : tmp & 0xFFF;
     return true;
   }
@@ -187,10 +283,34 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t *value) {
   else
     return false;
 
-  if (lba != cacheBlockNumber_ && !cacheRawBlock(lba, CACHE_FOR_READ))
-    return false;
+  const cache_t * const fc = cacheFatBlock(lba, CACHE_FOR_READ);
+  if (!fc) return false;
+
+  *value = (fatType_ == 16) ? fc->fat16[cluster & 0xFF] : (fc->fat32[cluster & 0x7F] & FAT32MASK);
+  return true;
+}
+
+/**
+ * Find where the contiguous run of clusters starting at 'cluster' ends,
+ * as far as the FAT block holding its entry shows. Each cluster before
+ * 'end' is followed by the next cluster number.
+ */
+bool SdVolume::fatRunEnd(uint32_t cluster, uint32_t *end) {
+  *end = cluster;
+  if (cluster > (clusterCount_ + 1)) return false;
+  if (fatType_ != 16 && fatType_ != 32) return true;
+
+  const uint8_t shift = fatType_ == 16 ? 8 : 7;
+  const uint16_t last = _BV(shift) - 1;
+  const cache_t * const fc = cacheFatBlock(fatStartBlock_ + (cluster >> shift), CACHE_FOR_READ);
+  if (!fc) return false;
 
-  *value = (fatType_ == 16) ? cacheBuffer_.fat16[cluster & 0xFF] : (cacheBuffer_.fat32[cluster & 0x7F] & FAT32MASK);
+  for (uint16_t i = cluster & last; i <= last; i++) {
+    const uint32_t next = (fatType_ == 16) ? fc->fat16[i] : (fc->fat32[i] & FAT32MASK);
+    if (next != cluster + 1) break;
+    cluster = next;
+  }
+  *end = cluster;
   return true;
 }
 
@@ -209,28 +329,25 @@ bool SdVolume::fatPut(uint32_t cluster, uint32_t value) {
     uint16_t index = cluster;
     index += index >> 1;
     lba = fatStartBlock_ + (index >> 9);
-    if (!cacheRawBlock(lba, CACHE_FOR_WRITE)) return false;
-    // mirror second FAT
-    if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_;
+    cache_t *fc = cacheFatBlock(lba, CACHE_FOR_WRITE);
+    if (!fc) return false;
     index &= 0x1FF;
     uint8_t tmp = value;
     if (cluster & 1) {
-      tmp = (cacheBuffer_.data[index] & 0xF) | tmp << 4;
+      tmp = (fc->data[index] & 0xF) | tmp << 4;
     }
-    cacheBuffer_.data[index] = tmp;
+    fc->data[index] = tmp;
     index++;
     if (index == 512) {
       lba++;
       index = 0;
-      if (!cacheRawBlock(lba, CACHE_FOR_WRITE)) return false;
-      // mirror second FAT
-      if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_;
+      if (!(fc = cacheFatBlock(lba, CACHE_FOR_WRITE))) return false;
     }
     tmp = value >> 4;
     if (!(cluster & 1)) {
-      tmp = ((cacheBuffer_.data[index] & 0xF0)) | tmp >> 4;
+      tmp = ((fc->data[index] & 0xF0)) | tmp >> 4;
     }
-    cacheBuffer_.data[index] = tmp;
+    fc->data[index] = tmp;
     return true;
   }
 
@@ -241,16 +358,17 @@ bool SdVolume::fatPut(uint32_t cluster, uint32_t value) {
   else
     return false;
 
-  if (!cacheRawBlock(lba, CACHE_FOR_WRITE)) return false;
+  cache_t * const fc = cacheFatBlock(lba, CACHE_FOR_WRITE); // also marks the second FAT
+  if (!fc) return false;
 
   // store entry
   if (fatType_ == 16)
-    cacheBuffer_.fat16[cluster & 0xFF] = value;
+    fc->fat16[cluster & 0xFF] = value;
   else
-    cacheBuffer_.fat32[cluster & 0x7F] = value;
+    fc->fat32[cluster & 0x7F] = value;
+
+  TERN_(SD_FREE_CLUSTER_MAP, if (!value) freeMapRelease(cluster));
 
-  // mirror second FAT
-  if (fatCount_ > 1) cacheMirrorBlock_ = lba + blocksPerFat_;
   return true;
 }
 
@@ -289,15 +407,16 @@ int32_t SdVolume::freeClusterCount() {
     return -1;
 
   for (uint32_t lba = fatStartBlock_; todo; todo -= n, lba++) {
-    if (!cacheRawBlock(lba, CACHE_FOR_READ)) return -1;
+    const cache_t * const fc = cacheFatBlock(lba, CACHE_FOR_READ);
+    if (!fc) return -1;
     NOMORE(n, todo);
     if (fatType_ == 16) {
       for (uint16_t i = 0; i < n; i++)
-        if (cacheBuffer_.fat16[i] == 0) free++;
+        if (fc->fat16[i] == 0) free++;
     }
     else {
       for (uint16_t i = 0; i < n; i++)
-        if (cacheBuffer_.fat32[i] == 0) free++;
+        if (fc->fat32[i] == 0) free++;
     }
     #ifdef ESP32
       // Needed to reset the idle task watchdog timer on ESP32 as reading the complete FAT may easily
@@ -313,6 +432,77 @@ int32_t SdVolume::freeClusterCount() {
   return free;
 }
 
+#if ENABLED(SD_FREE_CLUSTER_MAP)
+
+  /**
+   * Start a new free-cluster map. Every group of FAT blocks is taken to
+   * hold free clusters until a scan of the group finds none.
+   */
+  void SdVolume::freeMapInit() {
+    freeMapShift_ = 0;
+    freeMapNext_ = 0;
+    freeMapFree_ = false;
+    if (fatType_ != 16 && fatType_ != 32) return;
+
+    // use the fewest FAT blocks per map bit that cover the whole FAT
+    uint8_t shift = fatType_ == 16 ? 8 : 7;
+    while (((clusterCount_ + 1) >> shift) >= SD_FREE_CLUSTER_MAP_BYTES * 8UL) shift++;
+    freeMapShift_ = shift;
+
+    memset(freeMap_, 0xFF, sizeof(freeMap_));
+    freeMapNext_ = 2;
+  }
+
+  // A cluster was freed, so its group holds a free cluster again
+  void SdVolume::freeMapRelease(uint32_t cluster) {
+    if (!freeMapShift_) return;
+    freeMapMark(cluster, true);
+    if (freeMapNext_ && (cluster >> freeMapShift_) == (freeMapNext_ >> freeMapShift_))
+      freeMapFree_ = true;
+  }
+
+  /**
+   * Read one FAT block toward the free-cluster map, in the background.
+   * A group is marked full once all its blocks have been read without
+   * finding a free cluster. The rest of a group is skipped when one is found.
+   *
+   * \return true while there is more of the FAT to read.
+   */
+  bool SdVolume::freeMapStep() {
+    if (!freeMapNext_) return false;
+
+    const uint8_t shift = fatType_ == 16 ? 8 : 7;
+    const uint16_t last = _BV(shift) - 1;
+    const cache_t * const fc = cacheFatBlock(fatStartBlock_ + (freeMapNext_ >> shift), CACHE_FOR_READ);
+    if (!fc) {
+      // leave the unread groups marked as free
+      freeMapNext_ = 0;
+      return false;
+    }
+
+    const uint32_t fatEnd = clusterCount_ + 1,
+                   blockEnd = _MIN(freeMapNext_ | last, fatEnd),
+                   groupEnd = freeMapGroupEnd(freeMapNext_);
+
+    for (uint32_t c = freeMapNext_; c <= blockEnd && !freeMapFree_; c++) {
+      const uint32_t f = (fatType_ == 16) ? fc->fat16[c & last] : (fc->fat32[c & last] & FAT32MASK);
+      if (f == 0) freeMapFree_ = true;
+    }
+
+    if (freeMapFree_ || blockEnd == groupEnd) {
+      if (!freeMapFree_) freeMapMark(freeMapNext_, false);
+      freeMapFree_ = false;
+      freeMapNext_ = groupEnd + 1;
+    }
+    else
+      freeMapNext_ = blockEnd + 1;
+
+    if (freeMapNext_ > fatEnd) freeMapNext_ = 0;
+    return freeMapNext_ != 0;
+  }
+
+#endif // SD_FREE_CLUSTER_MAP
+
 /** Initialize a FAT volume.
  *
  * \param[in] dev The SD card where the volume is located.
@@ -333,9 +523,18 @@ bool SdVolume::init(DiskIODriver* dev, uint8_t part) {
   sdCard_ = dev;
   fatType_ = 0;
   allocSearchStart_ = 2;
+  TERN_(SD_FREE_CLUSTER_MAP, freeMapShift_ = freeMapNext_ = 0);
   cacheDirty_ = 0;  // cacheFlush() will write block if true
   cacheMirrorBlock_ = 0;
   cacheBlockNumber_ = 0xFFFFFFFF;
+  #if SD_FAT_CACHE_BLOCKS
+    for (fat_cache_t &fc : fatCache_) {
+      fc.blockNumber = 0xFFFFFFFF;
+      fc.mirrorBlock = fc.lastUse = 0;
+      fc.dirty = false;
+    }
+    fatCacheClock_ = 0;
+  #endif
 
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
@@ -399,6 +598,7 @@ bool SdVolume::init(DiskIODriver* dev, uint8_t part) {
     rootDirStart_ = fbs->fat32RootCluster;
     fatType_ = 32;
   }
+  TERN_(SD_FREE_CLUSTER_MAP, freeMapInit());
   return true;
 }
 
@@ -64,6 +64,19 @@ union cache_t {
   fat32_fsinfo_t  fsinfo;     // Used to access to a cached FAT32 FSINFO sector.
 };
 
+#if SD_FAT_CACHE_BLOCKS
+  /**
+   * \brief Cache for a FAT block
+   */
+  struct fat_cache_t {
+    cache_t   buffer;       // FAT block data
+    uint32_t  blockNumber;  // Logical number of block in the cache
+    uint32_t  mirrorBlock;  // Block number for mirror FAT
+    uint32_t  lastUse;      // Access stamp for LRU replacement
+    bool      dirty;        // cacheFlush() will write block if true
+  };
+#endif
+
 /**
  * \class SdVolume
  * \brief Access FAT16 and FAT32 volumes on SD and SDHC cards.
@@ -106,6 +119,9 @@ class SdVolume {
   uint32_t fatStartBlock() const { return fatStartBlock_; }      //> \return The logical block number for the start of the first FAT.
   uint8_t fatType() const { return fatType_; }                   //> \return The FAT type of the volume. Values are 12, 16 or 32.
   int32_t freeClusterCount();
+  #if ENABLED(SD_FREE_CLUSTER_MAP)
+    bool freeMapStep();
+  #endif
   uint32_t rootDirEntryCount() const { return rootDirEntryCount_; } /** \return The number of entries in the root directory for FAT16 volumes. */
 
   /**
@@ -144,12 +160,20 @@ class SdVolume {
     DiskIODriver *sdCard_;       // DiskIODriver object for cache
     bool cacheDirty_;            // cacheFlush() will write block if true
     uint32_t cacheMirrorBlock_;  // block number for mirror FAT
+    #if SD_FAT_CACHE_BLOCKS
+      fat_cache_t fatCache_[SD_FAT_CACHE_BLOCKS]; // FAT blocks, apart from file data
+      uint32_t fatCacheClock_;                    // Stamp for the next FAT cache access
+    #endif
   #else
     static cache_t cacheBuffer_;        // 512 byte cache for device blocks
     static uint32_t cacheBlockNumber_;  // Logical number of block in the cache
     static DiskIODriver *sdCard_;       // DiskIODriver object for cache
     static bool cacheDirty_;            // cacheFlush() will write block if true
     static uint32_t cacheMirrorBlock_;  // block number for mirror FAT
+    #if SD_FAT_CACHE_BLOCKS
+      static fat_cache_t fatCache_[SD_FAT_CACHE_BLOCKS]; // FAT blocks, apart from file data
+      static uint32_t fatCacheClock_;                    // Stamp for the next FAT cache access
+    #endif
   #endif
 
   uint32_t allocSearchStart_;   // start cluster for alloc search
@@ -163,6 +187,12 @@ class SdVolume {
   uint8_t fatType_;             // volume type (12, 16, OR 32)
   uint16_t rootDirEntryCount_;  // number of entries in FAT16 root dir
   uint32_t rootDirStart_;       // root start block for FAT16, cluster for FAT32
+  #if ENABLED(SD_FREE_CLUSTER_MAP)
+    uint8_t freeMap_[SD_FREE_CLUSTER_MAP_BYTES]; // Bit set if a group of FAT blocks may hold a free cluster
+    uint8_t freeMapShift_;      // shift from cluster number to map bit, 0 if the map is unused
+    uint32_t freeMapNext_;      // next cluster for the background scan, 0 when done
+    bool freeMapFree_;          // the background scan found a free cluster in the current group
+  #endif
 
   bool allocContiguous(uint32_t count, uint32_t *curCluster);
   uint8_t blockOfCluster(uint32_t position) const { return (position >> 9) & (blocksPerCluster_ - 1); }
@@ -175,10 +205,17 @@ class SdVolume {
   #if USE_MULTIPLE_CARDS
     bool cacheFlush();
     bool cacheRawBlock(uint32_t blockNumber, bool dirty);
+    #if SD_FAT_CACHE_BLOCKS
+      bool fatCacheWrite(fat_cache_t &fc);
+    #endif
   #else
     static bool cacheFlush();
     static bool cacheRawBlock(uint32_t blockNumber, bool dirty);
+    #if SD_FAT_CACHE_BLOCKS
+      static bool fatCacheWrite(fat_cache_t &fc);
+    #endif
   #endif
+  cache_t* cacheFatBlock(uint32_t blockNumber, bool dirty);
 
   // used by SdBaseFile write to assign cache to SD location
   void cacheSetBlockNumber(uint32_t blockNumber, bool dirty) {
@@ -188,14 +225,26 @@ class SdVolume {
   void cacheSetDirty() { cacheDirty_ |= CACHE_FOR_WRITE; }
   bool chainSize(uint32_t beginCluster, uint32_t *size);
   bool fatGet(uint32_t cluster, uint32_t *value);
+  bool fatRunEnd(uint32_t cluster, uint32_t *end);
   bool fatPut(uint32_t cluster, uint32_t value);
   bool fatPutEOC(uint32_t cluster) { return fatPut(cluster, 0x0FFFFFFF); }
   bool freeChain(uint32_t cluster);
+  #if ENABLED(SD_FREE_CLUSTER_MAP)
+    void freeMapInit();
+    void freeMapRelease(uint32_t cluster);
+    uint32_t freeMapGroupEnd(uint32_t cluster) const { return _MIN(cluster | ((uint32_t(1) << freeMapShift_) - 1), clusterCount_ + 1); }
+    bool freeMapHolds(uint32_t cluster) const { cluster >>= freeMapShift_; return TEST(freeMap_[cluster >> 3], cluster & 7); }
+    void freeMapMark(uint32_t cluster, const bool free) {
+      cluster >>= freeMapShift_;
+      if (free) SBI(freeMap_[cluster >> 3], cluster & 7); else CBI(freeMap_[cluster >> 3], cluster & 7);
+    }
+  #endif
   bool isEOC(uint32_t cluster) const {
     if (FAT12_SUPPORT && fatType_ == 12) return  cluster >= FAT12EOC_MIN;
     if (fatType_ == 16) return cluster >= FAT16EOC_MIN;
     return  cluster >= FAT32EOC_MIN;
   }
   bool readBlock(uint32_t block, uint8_t *dst) { return sdCard_->readBlock(block, dst); }
+  bool readBlocks(uint32_t block, uint8_t *dst, uint16_t count) { return sdCard_->readBlocks(block, dst, count); }
   bool writeBlock(uint32_t block, const uint8_t *dst) { return sdCard_->writeBlock(block, dst); }
 };
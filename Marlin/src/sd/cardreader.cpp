@@ -144,6 +144,10 @@ SdFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_READ_AHEAD)
+  CardReader::ReadAhead CardReader::ahead;
+#endif
+
 CardReader::CardReader() {
   changeMedia(&
     #if HAS_USB_FLASH_DRIVE && !SHARED_VOLUME_IS(SD_ONBOARD)
@@ -331,7 +335,7 @@ void CardReader::printListing(SdFile parent,  const char * const prepend, const
         SERIAL_CHAR('/');
       }
 
-
+      CHANNEL_REDIRECT(PANEL);
       SERIAL_ECHOPGM("\xFF\xFF\xFF");
 
       if (sayac == 0){SERIAL_ECHOPGM("sd_1.txt=\"");}
@@ -490,6 +494,7 @@ void CardReader::ls(const uint8_t lsflags) {
 // Echo the DOS 8.3 filename (and long filename, if any)
 //
 void CardReader::printSelectedFilename() {
+  CHANNEL_REDIRECT(PANEL);
   if (file.isOpen()) {
     char dosFilename[FILENAME_LENGTH];
     file.getDosName(dosFilename);
@@ -601,6 +606,19 @@ void CardReader::manage_media() {
   IF_DISABLED(NO_SD_AUTOSTART, if (do_auto) autofile_begin());
 }
 
+#if ENABLED(SD_FREE_CLUSTER_MAP)
+
+  /**
+   * Build the free-cluster map a FAT block at a time, only while the
+   * machine is idle. A block read would stall a print or queued moves.
+   */
+  void CardReader::build_free_map() {
+    if (isMounted() && !isPrinting() && !planner.has_blocks_queued() && !queue.ring_buffer.occupied())
+      volume.freeMapStep();
+  }
+
+#endif
+
 /**
  * "Release" the media by clearing the 'mounted' flag.
  * Used by M22, "Release Media", manage_media.
@@ -643,9 +661,41 @@ void CardReader::startOrResumeFilePrinting() {
     flag.sdprinting = true;
     flag.sdprintdone = false;
     TERN_(SD_RESORT, flush_presort());
+    TERN_(PREDICTIVE_HEATUP, if (!sdpos) predictive_heatup.scan_media());
   }
 }
 
+#if ENABLED(SD_READ_AHEAD)
+
+  /**
+   * Fill one free block slot from the open file. The first read after a seek
+   * runs up to the next block boundary so the rest are whole aligned blocks,
+   * which SdBaseFile reads straight into the slot without using its cache.
+   * With nothing held the logical position is taken from the file, so bytes
+   * read directly beforehand are skipped just as they were by file.read().
+   * Return false if no slot is free or there is nothing more to read.
+   */
+  bool CardReader::read_ahead() {
+    if (ahead.count >= SD_READ_AHEAD_BLOCKS || !file.isOpen()) return false;
+    const uint32_t pos = file.curPosition();
+    if (pos >= filesize) return false;
+    // Fill the free slots up to the end of the ring with one read, so whole
+    // blocks go straight from the drive in a single multi-block transfer
+    const uint8_t slots = (pos & 0x1FF) ? 1 : _MIN(SD_READ_AHEAD_BLOCKS - ahead.count, SD_READ_AHEAD_BLOCKS - ahead.head, 32);
+    int16_t n = file.read(ahead.data[ahead.head], slots * 512U - (pos & 0x1FF));
+    if (n <= 0) return false;
+    if (!ahead.count) sdpos = pos;
+    do {
+      ahead.len[ahead.head] = _MIN(n, 512);
+      n -= ahead.len[ahead.head];
+      if (++ahead.head >= SD_READ_AHEAD_BLOCKS) ahead.head = 0;
+      ahead.count++;
+    } while (n > 0);
+    return true;
+  }
+
+#endif
+
 //
 // Run tasks upon finishing or aborting a file print.
 //
@@ -654,6 +704,8 @@ void CardReader::endFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/))
   TERN_(HAS_DWIN_E3V2_BASIC, HMI_flag.print_finish = flag.sdprinting);
   flag.abort_sd_printing = false;
   if (isFileOpen()) file.close();
+  drop_read_ahead();
+  TERN_(SD_COMPILED_JOBS, compiled_job.close());
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
@@ -696,7 +748,7 @@ void openFailed(const char * const fname) {
 
 void announceOpen(const uint8_t doing, const char * const path) {
   if (doing) {
-    PORT_REDIRECT(SerialMask::All);
+    PORT_REDIRECT(SERIAL_CHANNEL_MASK(HOST));
     SERIAL_ECHO_START();
     SERIAL_ECHOPGM("Now ");
     SERIAL_ECHOF(doing == 1 ? F("doing") : F("fresh"));
@@ -760,19 +812,27 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
-    char commandline[30];
-    int n = file.read(commandline,30);
-    commandline[n] = '\0';
-    long second;
-    sscanf(commandline, ";FLAVOR:Marlin ;TIME:%ld", &second);
-    SERIAL_ECHOPGM("\xFF\xFF\xFF");
-    SERIAL_ECHOPGM("ilksayfa.r.txt=\"");
-    SERIAL_ECHO(second);
-    SERIAL_ECHOPGM("\"\xFF\xFF\xFF");
+    drop_read_ahead();
+    long second = 0;
+    // A valid sidecar already holds the time estimate
+    if (!TERN0(SD_COMPILED_JOBS, !subcall_type && compiled_job.replay(diveDir, file, second))) {
+      char commandline[31];
+      int n = file.read(commandline,30);
+      commandline[n > 0 ? n : 0] = '\0';
+      sscanf(commandline, ";FLAVOR:Marlin ;TIME:%ld", &second);
+      TERN_(SD_COMPILED_JOBS, if (!subcall_type) compiled_job.prepare(diveDir, file, second));
+    }
+    {
+      CHANNEL_REDIRECT(PANEL);
+      SERIAL_ECHOPGM("\xFF\xFF\xFF");
+      SERIAL_ECHOPGM("ilksayfa.r.txt=\"");
+      SERIAL_ECHO(second);
+      SERIAL_ECHOPGM("\"\xFF\xFF\xFF");
+    }
     
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
-      PORT_REDIRECT(SerialMask::All);
+      PORT_REDIRECT(SERIAL_CHANNEL_MASK(HOST));
       SERIAL_ECHOLNPGM(STR_SD_FILE_OPENED, fname, STR_SD_SIZE, filesize);
       SERIAL_ECHOLNPGM(STR_SD_FILE_SELECTED);
     }
@@ -971,6 +1031,7 @@ void CardReader::closefile(const bool store_location/*=false*/) {
   file.close();
   flag.saving = flag.logging = false;
   sdpos = 0;
+  drop_read_ahead();
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
   if (store_location) {
@@ -1401,7 +1462,9 @@ uint16_t CardReader::get_num_Files() {
 // Return from procedure or close out the Print Job
 //
 void CardReader::fileHasFinished() {
+  TERN_(SD_COMPILED_JOBS, compiled_job.finish());
   file.close();
+  drop_read_ahead();
   #if HAS_MEDIA_SUBCALLS
     if (file_subcall_ctr > 0) { // Resume calling file after closing procedure
       file_subcall_ctr--;
@@ -1453,6 +1516,40 @@ void CardReader::fileHasFinished() {
     }
   }
 
+  #if ENABLED(POWER_LOSS_JOURNAL)
+
+    /**
+     * Get the first block of the contiguous job recovery journal.
+     * A missing or fragmented file is replaced by a new contiguous
+     * file with all blocks cleared.
+     */
+    bool CardReader::jobRecoveryJournal(uint32_t &first_block, const uint16_t blocks) {
+      if (!isMounted()) return false;
+
+      uint32_t bgn, end;
+      SdFile &file = recovery.file;
+      if (file.open(&root, recovery.filename, O_READ)) {
+        const bool ok = file.contiguousRange(&bgn, &end) && end - bgn + 1 >= blocks;
+        file.close();
+        if (ok) { first_block = bgn; return true; }
+        removeFile(recovery.filename);
+      }
+
+      const bool ok = file.createContiguous(&root, recovery.filename, uint32_t(blocks) * 512UL)
+                   && file.contiguousRange(&bgn, &end);
+      file.close();
+      if (!ok) { openFailed(recovery.filename); return false; }
+
+      // Old journal blocks in the new clusters must not be replayed
+      uint8_t zero[512] = { 0 };
+      LOOP_L_N(b, blocks) if (!driver->writeBlock(bgn + b, zero)) return false;
+
+      first_block = bgn;
+      return true;
+    }
+
+  #endif
+
 #endif // POWER_LOSS_RECOVERY
 
 #endif // SDSUPPORT
@@ -49,6 +49,10 @@ extern const char M23_STR[], M24_STR[];
 #include "SdFile.h"
 #include "disk_io_driver.h"
 
+#if ENABLED(SD_COMPILED_JOBS)
+  #include "../feature/compiled_job.h"
+#endif
+
 #if ENABLED(USB_FLASH_DRIVE_SUPPORT)
   #include "usb_flashdrive/Sd2Card_FlashDrive.h"
 #endif
@@ -125,6 +129,10 @@ public:
   // Handle media insert/remove
   static void manage_media();
 
+  #if ENABLED(SD_FREE_CLUSTER_MAP)
+    static void build_free_map();
+  #endif
+
   // SD Card Logging
   static void openLogFile(const char * const path);
   static void write_command(char * const buf);
@@ -216,6 +224,9 @@ public:
     static bool jobRecoverFileExists();
     static void openJobRecoveryFile(const bool read);
     static void removeJobRecoveryFile();
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static bool jobRecoveryJournal(uint32_t &first_block, const uint16_t blocks);
+    #endif
   #endif
 
   // Binary flag for the current file
@@ -233,10 +244,34 @@ public:
   static bool eof()              { return getIndex() >= getFileSize(); }
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
-  static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  #if ENABLED(SD_READ_AHEAD)
+    static int16_t get() {
+      if (!ahead.count && !read_ahead()) return -1;
+      const uint8_t c = ahead.data[ahead.tail][ahead.index];
+      if (++ahead.index >= ahead.len[ahead.tail]) {
+        ahead.index = 0;
+        if (++ahead.tail >= SD_READ_AHEAD_BLOCKS) ahead.tail = 0;
+        ahead.count--;
+      }
+      sdpos++;
+      return c;
+    }
+    static int16_t read(void *buf, uint16_t nbyte) {
+      if (!file.isOpen()) return -1;
+      if (ahead.count) setIndex(sdpos); // Resume direct reads where get() left off
+      return file.read(buf, nbyte);
+    }
+    static void setIndex(const uint32_t index)    { TERN_(SD_COMPILED_JOBS, compiled_job.seek(index)); drop_read_ahead(); file.seekSet((sdpos = index)); }
+    static bool read_ahead();
+  #else
+    static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
+    static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+    static void setIndex(const uint32_t index)      { TERN_(SD_COMPILED_JOBS, compiled_job.seek(index)); file.seekSet((sdpos = index)); }
+  #endif
+  #if ENABLED(SD_COMPILED_JOBS)
+    static void setReplayIndex(const uint32_t index) { sdpos = index; } // Position of a line replayed from a sidecar
+  #endif
   static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
 
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
@@ -329,6 +364,21 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  //
+  // Whole blocks read ahead of the print position, consumed by get()
+  //
+  #if ENABLED(SD_READ_AHEAD)
+    static struct ReadAhead {
+      uint8_t data[SD_READ_AHEAD_BLOCKS][512] __attribute__((aligned(4)));
+      uint16_t len[SD_READ_AHEAD_BLOCKS], // Bytes held in each block slot
+               index;                     // Next byte in the tail slot
+      uint8_t head, tail, count;          // Block slots filled / to consume / held
+    } ahead;
+    static void drop_read_ahead() { ahead.head = ahead.tail = ahead.count = 0; ahead.index = 0; }
+  #else
+    static void drop_read_ahead() {}
+  #endif
+
   //
   // Procedure calls to other files
   //
@@ -59,6 +59,25 @@ public:
   virtual bool readBlock(uint32_t block, uint8_t* dst) = 0;
   virtual bool writeBlock(uint32_t blockNumber, const uint8_t* src) = 0;
 
+  /**
+   * Read or write a range of consecutive blocks to or from one buffer.
+   * Drivers that can move several blocks in one command override these.
+   *
+   * \return true for success or false for failure.
+   */
+  virtual bool readBlocks(uint32_t block, uint8_t* dst, uint16_t count) {
+    if (!readStart(block)) return false;
+    for (; count; --count, dst += 512)
+      if (!readData(dst)) return false;
+    return readStop();
+  }
+  virtual bool writeBlocks(uint32_t block, const uint8_t* src, uint16_t count) {
+    if (!writeStart(block, count)) return false;
+    for (; count; --count, src += 512)
+      if (!writeData(src)) return false;
+    return writeStop();
+  }
+
   virtual uint32_t cardSize() = 0;
 
   virtual bool isReady() = 0;
@@ -107,6 +107,7 @@
 #endif
 
 #include "Sd2Card_FlashDrive.h"
+#include "bulk_transfer.h"
 
 #include "../../lcd/marlinui.h"
 
@@ -325,4 +326,38 @@ bool DiskIODriver_USBFlash::writeBlock(uint32_t block, const uint8_t *src) {
   return bulk.Write(0, block, 512, 1, src) == 0;
 }
 
+// Read a range of blocks with as few SCSI commands as possible
+bool DiskIODriver_USBFlash::readBlocks(uint32_t block, uint8_t *dst, uint16_t count) {
+  if (!isInserted()) return false;
+  #if USB_DEBUG >= 3
+    if (block + count > lun0_capacity) {
+      SERIAL_ECHOLNPGM("Attempt to read past end of LUN: ", block + count - 1);
+      return false;
+    }
+    #if USB_DEBUG >= 4
+      SERIAL_ECHOLNPGM("Read blocks ", block, " x", count);
+    #endif
+  #endif
+  return bulk_transfer_blocks(block, dst, count, [](const uint32_t b, uint8_t * const d, const uint8_t n) {
+    return bulk.Read(0, b, 512, n, d);
+  });
+}
+
+// Write a range of blocks with as few SCSI commands as possible
+bool DiskIODriver_USBFlash::writeBlocks(uint32_t block, const uint8_t *src, uint16_t count) {
+  if (!isInserted()) return false;
+  #if USB_DEBUG >= 3
+    if (block + count > lun0_capacity) {
+      SERIAL_ECHOLNPGM("Attempt to write past end of LUN: ", block + count - 1);
+      return false;
+    }
+    #if USB_DEBUG >= 4
+      SERIAL_ECHOLNPGM("Write blocks ", block, " x", count);
+    #endif
+  #endif
+  return bulk_transfer_blocks(block, src, count, [](const uint32_t b, const uint8_t * const s, const uint8_t n) {
+    return bulk.Write(0, b, 512, n, s);
+  });
+}
+
 #endif // USB_FLASH_DRIVE_SUPPORT
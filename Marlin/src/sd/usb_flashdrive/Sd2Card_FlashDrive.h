@@ -72,6 +72,9 @@ class DiskIODriver_USBFlash : public DiskIODriver {
     bool readBlock(uint32_t block, uint8_t *dst) override;
     bool writeBlock(uint32_t blockNumber, const uint8_t *src) override;
 
+    bool readBlocks(uint32_t block, uint8_t *dst, uint16_t count) override;
+    bool writeBlocks(uint32_t block, const uint8_t *src, uint16_t count) override;
+
     uint32_t cardSize() override;
 
     bool isReady() override;
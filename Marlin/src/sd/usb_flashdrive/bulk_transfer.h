@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * \file
+ * \brief Split a multi-block transfer into bulk-only READ(10) / WRITE(10) commands
+ */
+#include <stdint.h>
+
+// Most blocks moved by one READ(10) or WRITE(10) command
+#define USB_MAX_BLOCKS_PER_TRANSFER 64
+
+/**
+ * Move a range of blocks with as few SCSI commands as possible.
+ * xfer(block, buf, n) moves n blocks and returns 0 for success, as BulkOnly::Read and
+ * BulkOnly::Write do. The transfer ends at the first command that fails.
+ *
+ * \return true for success or false for failure.
+ */
+template<typename T, typename XFER>
+bool bulk_transfer_blocks(uint32_t block, T *buf, uint16_t count, XFER xfer) {
+  while (count) {
+    const uint8_t n = count < USB_MAX_BLOCKS_PER_TRANSFER ? count : USB_MAX_BLOCKS_PER_TRANSFER;
+    if (xfer(block, buf, n)) return false;
+    block += n; buf += n * 512U; count -= n;
+  }
+  return true;
+}
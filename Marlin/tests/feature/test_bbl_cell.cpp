@@ -0,0 +1,109 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Check the precomputed bilinear cell terms of ABL_CELL_COEFFICIENTS against
+ * the corner blend that get_z_correction() uses without them.
+ */
+
+#include "../unit_tests.h"
+#include "../../src/feature/bedlevel/abl/bbl_cell.h"
+
+// The blend of get_z_correction(), from corners left-front, left-back, right-front, right-back
+static float corner_blend(const float z1, const float z2, const float z3, const float z4, const float rx, const float ry) {
+  const float L = z1 + (z2 - z1) * ry, R = z3 + (z4 - z3) * ry;
+  return L + rx * (R - L);
+}
+
+static float rnd_float(marlin_tests::Random &rnd, const float lo, const float hi) {
+  return lo + (hi - lo) * (rnd.next() / 4294967296.0f);
+}
+
+// Random meshes, with ratios past the cell as with EXTRAPOLATE_BEYOND_GRID
+MARLIN_TEST(bbl_cell, equivalence) {
+  marlin_tests::Random rnd;
+  float worst_float = 0, worst_fixed = 0;
+  for (uint32_t i = 0; i < 1000000; i++) {
+    const float z1 = rnd_float(rnd, -3, 3), z2 = rnd_float(rnd, -3, 3),
+                z3 = rnd_float(rnd, -3, 3), z4 = rnd_float(rnd, -3, 3),
+                rx = rnd_float(rnd, -0.5f, 1.5f), ry = rnd_float(rnd, -0.5f, 1.5f);
+    bbl_cell_float_t cf; cf.set(z1, z2, z3, z4);
+    bbl_cell_fixed_t cq; cq.set(z1, z2, z3, z4);
+    const float ref = corner_blend(z1, z2, z3, z4, rx, ry);
+    worst_float = fmaxf(worst_float, fabsf(cf.at(rx, ry) - ref));
+    worst_fixed = fmaxf(worst_fixed, fabsf(cq.at(rx, ry) - ref));
+  }
+  printf("  Largest difference: float %.2e mm, fixed %.2e mm\n", double(worst_float), double(worst_fixed));
+  TEST_ASSERT(worst_float < 1e-5f);
+  TEST_ASSERT(worst_fixed < 2e-4f);   // Rounding of the Q16 ratios, far below a microstep
+}
+
+// Fixed point gives each corner exactly, and an unprobed corner reads as 0
+MARLIN_TEST(bbl_cell, fixed_corners) {
+  marlin_tests::Random rnd(0x600DCE11);
+  for (uint32_t i = 0; i < 100000; i++) {
+    const float z[4] = { rnd_float(rnd, -5, 5), rnd_float(rnd, -5, 5), rnd_float(rnd, -5, 5), rnd_float(rnd, -5, 5) };
+    bbl_cell_fixed_t c; c.set(z[0], z[1], z[2], z[3]);
+    if (!TEST_ASSERT_EQUAL(c.at_fixed(0, 0), bbl_cell_fixed_t::to_fixed(z[0]))
+     || !TEST_ASSERT_EQUAL(c.at_fixed(0, 65536), bbl_cell_fixed_t::to_fixed(z[1]))
+     || !TEST_ASSERT_EQUAL(c.at_fixed(65536, 0), bbl_cell_fixed_t::to_fixed(z[2]))
+     || !TEST_ASSERT_EQUAL(c.at_fixed(65536, 65536), bbl_cell_fixed_t::to_fixed(z[3]))
+    ) return;
+  }
+  bbl_cell_fixed_t c; c.set(NAN, 1, 1, 1);
+  TEST_ASSERT_EQUAL(c.at_fixed(0, 0), 0);
+}
+
+MARLIN_BENCH(bbl_cell, evaluate) {
+  constexpr uint32_t cells = 64, points = 1024, rounds = 2000, ops = rounds * points;
+  static float corners[cells][4], ratios[points][2];
+  static bbl_cell_float_t cf[cells];
+  static bbl_cell_fixed_t cq[cells];
+  marlin_tests::Random rnd;
+  for (uint32_t i = 0; i < cells; i++) {
+    for (float &z : corners[i]) z = rnd_float(rnd, -1, 1);
+    cf[i].set(corners[i][0], corners[i][1], corners[i][2], corners[i][3]);
+    cq[i].set(corners[i][0], corners[i][1], corners[i][2], corners[i][3]);
+  }
+  for (auto &r : ratios) { r[0] = rnd_float(rnd, 0, 1); r[1] = rnd_float(rnd, 0, 1); }
+
+  // Each point is in a different cell, so nothing is reused from the last one
+  uint64_t t0 = marlin_tests::nanos();
+  for (uint32_t n = 0; n < rounds; n++)
+    for (uint32_t p = 0; p < points; p++) {
+      const float * const z = corners[p % cells];
+      marlin_tests::float_sink = corner_blend(z[0], z[1], z[2], z[3], ratios[p][0], ratios[p][1]);
+    }
+  marlin_tests::report("corner blend", marlin_tests::nanos() - t0, ops);
+
+  t0 = marlin_tests::nanos();
+  for (uint32_t n = 0; n < rounds; n++)
+    for (uint32_t p = 0; p < points; p++)
+      marlin_tests::float_sink = cf[p % cells].at(ratios[p][0], ratios[p][1]);
+  marlin_tests::report("float cell terms", marlin_tests::nanos() - t0, ops);
+
+  t0 = marlin_tests::nanos();
+  for (uint32_t n = 0; n < rounds; n++)
+    for (uint32_t p = 0; p < points; p++)
+      marlin_tests::float_sink = cq[p % cells].at(ratios[p][0], ratios[p][1]);
+  marlin_tests::report("fixed cell terms", marlin_tests::nanos() - t0, ops);
+}
@@ -0,0 +1,134 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Check the direct decimal conversion against strtof, which value_float()
+ * used for every value before. Each value the direct path accepts must
+ * convert to the very same float.
+ */
+
+#include "../unit_tests.h"
+#include "../../src/libs/decimal.h"
+
+#include <stdlib.h>
+
+// The strtof path of value_float, which stops at 'E' and 'X'
+static float strtof_value(const char * const value) {
+  char buf[32];
+  size_t n = 0;
+  for (; value[n] && n < sizeof(buf) - 1; n++) {
+    const char c = value[n];
+    if (c == 'E' || c == 'e' || c == 'X' || c == 'x') break;
+    buf[n] = c;
+  }
+  buf[n] = '\0';
+  return strtof(buf, nullptr);
+}
+
+// Convert a string both ways. 'true' if the direct path declined or agrees exactly.
+static bool same_as_strtof(const char * const s, bool &direct) {
+  float f;
+  direct = decimal_to_float(s, f);
+  if (!direct) return true;
+  const float ref = strtof_value(s);
+  return !memcmp(&f, &ref, sizeof(f));
+}
+
+static bool check_value(const char * const s, const bool expect_direct) {
+  bool direct;
+  const bool same = same_as_strtof(s, direct);
+  if (!same || direct != expect_direct) printf("  Value \"%s\"\n", s);
+  return TEST_ASSERT(same) && TEST_ASSERT_EQUAL(direct, expect_direct);
+}
+
+MARLIN_TEST(decimal, typical_values) {
+  static const char * const direct[] = {
+    "0", "-0", "+0", "1", "-1", "200", "0.1", "-0.1", ".5", "5.", "-.25",
+    "123.456", "-123.456", "0.0125", "2.50000000000", "000012.5", "9999999",
+    "16777215", "0.0000001", "1.5 Y2", "1.5*37", "12.5;", "1E5", "1.5e-3",
+    "0x10", "3-4", "1..2"
+  };
+  for (const char * const s : direct) check_value(s, true);
+
+  static const char * const fallback[] = {
+    "", "-", "+", ".", "-.", " 5", "16777216", "123456789", "0.00000000001",
+    "1.23456789", "inf", "nan", "--1", "+-1"
+  };
+  for (const char * const s : fallback) check_value(s, false);
+}
+
+// Every value with up to 7 digits, at every position of the point
+MARLIN_TEST(decimal, all_short_values) {
+  char s[16];
+  for (uint32_t v = 0; v < 10000000; v += (v < 100000 ? 1 : 7)) {
+    for (uint8_t places = 0; places <= 7; places++) {
+      char digits[12];
+      const int len = snprintf(digits, sizeof(digits), "%0*u", places + 1, v);
+      memcpy(s, digits, len - places);
+      s[len - places] = '.';
+      strcpy(s + len - places + 1, digits + len - places);
+      bool direct;
+      if (!TEST_ASSERT(same_as_strtof(s, direct))) { printf("  Value \"%s\"\n", s); return; }
+    }
+  }
+}
+
+// Random floats printed the way hosts and slicers print them
+MARLIN_TEST(decimal, printed_floats) {
+  marlin_tests::Random rnd;
+  char s[48];
+  for (uint32_t i = 0; i < 2000000; i++) {
+    const float f = (int32_t(rnd.next()) / 2147483648.0f) * (rnd.below(2) ? 1000.0f : 10.0f);
+    snprintf(s, sizeof(s), "%.*f", int(rnd.below(7)), f);
+    bool direct;
+    if (!TEST_ASSERT(same_as_strtof(s, direct))) { printf("  Value \"%s\"\n", s); return; }
+  }
+}
+
+// Random strings of number characters, plus the characters that end a value
+MARLIN_TEST(decimal, fuzz) {
+  static const char chars[] = "0123456789000000.-+eExX *;";
+  marlin_tests::Random rnd(0x12345678);
+  char s[20];
+  for (uint32_t i = 0; i < 2000000; i++) {
+    const uint8_t len = 1 + rnd.below(sizeof(s) - 1);
+    for (uint8_t n = 0; n < len; n++) s[n] = chars[rnd.below(sizeof(chars) - 1)];
+    s[len] = '\0';
+    bool direct;
+    if (!TEST_ASSERT(same_as_strtof(s, direct))) { printf("  Value \"%s\"\n", s); return; }
+  }
+}
+
+MARLIN_BENCH(decimal, convert) {
+  static const char * const values[] = { "123.456", "-0.8", "12.5", "0.0125", "200", "35.1234", "1.5", "-10.25" };
+  constexpr uint32_t rounds = 1000000, ops = rounds * COUNT(values);
+
+  uint64_t t0 = marlin_tests::nanos();
+  for (uint32_t r = 0; r < rounds; r++)
+    for (const char * const s : values) { float f = 0; decimal_to_float(s, f); marlin_tests::float_sink = f; }
+  marlin_tests::report("decimal_to_float", marlin_tests::nanos() - t0, ops);
+
+  t0 = marlin_tests::nanos();
+  for (uint32_t r = 0; r < rounds; r++)
+    for (const char * const s : values) marlin_tests::float_sink = strtof_value(s);
+  marlin_tests::report("strtof (stopping at E/X)", marlin_tests::nanos() - t0, ops);
+}
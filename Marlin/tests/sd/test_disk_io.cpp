@@ -0,0 +1,226 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Check the multi-block transfers of DiskIODriver against an in-memory
+ * stand-in for a mass-storage device. The stand-in keeps to the streaming
+ * protocol of a card (start, one call per block, stop) and counts commands.
+ * The USB flash drive splitting of a range into READ(10) / WRITE(10) commands
+ * is checked against an in-memory stand-in for BulkOnly::Read / Write.
+ */
+
+#include "../unit_tests.h"
+
+typedef int16_t pin_t;
+#include "../../src/sd/SdInfo.h"
+#include "../../src/sd/disk_io_driver.h"
+#include "../../src/sd/usb_flashdrive/bulk_transfer.h"
+
+#define RAM_BLOCKS 256
+
+class DiskIODriver_RAM : public DiskIODriver {
+public:
+  uint8_t data[RAM_BLOCKS][512];
+  uint32_t commands = 0,        // Start commands, plus single block calls
+           fail_at = UINT32_MAX; // Block to fail on, for error tests
+
+  bool init(const uint8_t, const pin_t) override { return true; }
+  bool readCSD(csd_t*) override { return false; }
+
+  bool readStart(const uint32_t block) override { return start(block, READING, 0); }
+  bool readData(uint8_t *dst) override {
+    if (!next(READING)) return false;
+    memcpy(dst, data[pos++], 512);
+    return true;
+  }
+  bool readStop() override { return stop(READING); }
+
+  bool writeStart(const uint32_t block, const uint32_t count) override { return start(block, WRITING, count); }
+  bool writeData(const uint8_t *src) override {
+    if (!next(WRITING)) return false;
+    memcpy(data[pos++], src, 512);
+    left--;
+    return true;
+  }
+  bool writeStop() override { return TEST_ASSERT_EQUAL(left, 0U) && stop(WRITING); }
+
+  bool readBlock(uint32_t block, uint8_t *dst) override {
+    return start(block, READING, 0) && readData(dst) && stop(READING);
+  }
+  bool writeBlock(uint32_t block, const uint8_t *src) override {
+    return start(block, WRITING, 1) && writeData(src) && stop(WRITING);
+  }
+
+  uint32_t cardSize() override { return RAM_BLOCKS; }
+  bool isReady() override { return true; }
+  void idle() override {}
+
+private:
+  enum Stream : uint8_t { IDLE, READING, WRITING };
+  Stream stream = IDLE;
+  uint32_t pos = 0, left = 0;
+
+  bool start(const uint32_t block, const Stream s, const uint32_t count) {
+    if (!TEST_ASSERT_EQUAL(stream, IDLE) || !TEST_ASSERT(block < RAM_BLOCKS)) return false;
+    stream = s; pos = block; left = count;
+    commands++;
+    return true;
+  }
+  bool next(const Stream s) {
+    if (!TEST_ASSERT_EQUAL(stream, s) || !TEST_ASSERT(pos < RAM_BLOCKS)) return false;
+    if (pos == fail_at) { stream = IDLE; return false; }
+    return true;
+  }
+  bool stop(const Stream s) {
+    if (!TEST_ASSERT_EQUAL(stream, s)) return false;
+    stream = IDLE;
+    return true;
+  }
+};
+
+static DiskIODriver_RAM disk;
+static uint8_t image[RAM_BLOCKS][512], buf[RAM_BLOCKS * 512];
+
+// Random ranges written and read back, compared with a copy of the media
+MARLIN_TEST(disk_io, random_ranges) {
+  marlin_tests::Random rnd;
+  for (uint32_t b = 0; b < RAM_BLOCKS; b++)
+    for (uint16_t i = 0; i < 512; i++) image[b][i] = disk.data[b][i] = rnd.next();
+
+  for (uint32_t i = 0; i < 20000; i++) {
+    const uint32_t block = rnd.below(RAM_BLOCKS);
+    const uint16_t count = 1 + rnd.below(RAM_BLOCKS - block);
+    const uint32_t commands = disk.commands;
+    if (rnd.below(2)) {
+      for (uint32_t n = 0; n < count * 512U; n++) buf[n] = rnd.next();
+      if (!TEST_ASSERT(disk.writeBlocks(block, buf, count))) return;
+      memcpy(image[block], buf, count * 512U);
+    }
+    else {
+      if (!TEST_ASSERT(disk.readBlocks(block, buf, count))) return;
+      if (!TEST_ASSERT(!memcmp(buf, image[block], count * 512U))) { printf("  Read %u x%u\n", unsigned(block), count); return; }
+    }
+    if (!TEST_ASSERT_EQUAL(disk.commands - commands, 1U)) return;
+  }
+  TEST_ASSERT(!memcmp(disk.data, image, sizeof(image)));
+}
+
+// A failed block ends the transfer with an error, and the stream can start over
+MARLIN_TEST(disk_io, failed_block) {
+  disk.fail_at = 20;
+  TEST_ASSERT(!disk.readBlocks(16, buf, 8));
+  TEST_ASSERT(!disk.writeBlocks(18, buf, 4));
+  TEST_ASSERT(disk.readBlocks(21, buf, 8));
+  TEST_ASSERT(disk.writeBlocks(12, buf, 8));
+  disk.fail_at = UINT32_MAX;
+  TEST_ASSERT(disk.readBlocks(0, buf, RAM_BLOCKS));
+}
+
+// In-memory stand-in for BulkOnly::Read / Write on the same media
+struct BulkOnly_RAM {
+  uint32_t commands = 0, blocks = 0, // Commands issued and blocks they moved
+           largest = 0,              // Most blocks in one command
+           fail_on = UINT32_MAX;     // Command to fail, for error tests
+  uint8_t Read(const uint32_t addr, const uint8_t n, uint8_t *buf) {
+    if (!check(addr, n)) return 1;
+    memcpy(buf, disk.data[addr], n * 512U);
+    return 0;
+  }
+  uint8_t Write(const uint32_t addr, const uint8_t n, const uint8_t *buf) {
+    if (!check(addr, n)) return 1;
+    memcpy(disk.data[addr], buf, n * 512U);
+    return 0;
+  }
+private:
+  bool check(const uint32_t addr, const uint8_t n) {
+    if (commands++ == fail_on || !TEST_ASSERT(n > 0) || !TEST_ASSERT(addr + n <= RAM_BLOCKS)) return false;
+    blocks += n;
+    if (n > largest) largest = n;
+    return true;
+  }
+};
+
+static BulkOnly_RAM bulk;
+
+static bool usb_read(const uint32_t block, uint8_t *dst, const uint16_t count) {
+  return bulk_transfer_blocks(block, dst, count, [](const uint32_t b, uint8_t * const d, const uint8_t n) { return bulk.Read(b, n, d); });
+}
+static bool usb_write(const uint32_t block, const uint8_t *src, const uint16_t count) {
+  return bulk_transfer_blocks(block, src, count, [](const uint32_t b, const uint8_t * const s, const uint8_t n) { return bulk.Write(b, n, s); });
+}
+
+// Ranges around the 64-block limit go out in as few commands as possible and land in place
+MARLIN_TEST(usb_flash, chunked_ranges) {
+  marlin_tests::Random rnd;
+  static const uint16_t counts[] = { 1, 2, 63, 64, 65, 127, 128, 129, 200, 255, 256 };
+  for (const uint16_t count : counts) {
+    const uint32_t block = rnd.below(RAM_BLOCKS - count + 1);
+    for (uint32_t n = 0; n < count * 512U; n++) buf[n] = rnd.next();
+
+    bulk = BulkOnly_RAM();
+    if (!TEST_ASSERT(usb_write(block, buf, count))) return;
+    if (!TEST_ASSERT_EQUAL(bulk.commands, (count + 63U) / 64U)) return;
+    if (!TEST_ASSERT_EQUAL(bulk.blocks, uint32_t(count))) return;
+    if (!TEST_ASSERT(bulk.largest <= USB_MAX_BLOCKS_PER_TRANSFER)) return;
+    if (!TEST_ASSERT(!memcmp(disk.data[block], buf, count * 512U))) { printf("  Write %u x%u\n", unsigned(block), count); return; }
+
+    static uint8_t back[RAM_BLOCKS * 512];
+    bulk = BulkOnly_RAM();
+    if (!TEST_ASSERT(usb_read(block, back, count))) return;
+    if (!TEST_ASSERT_EQUAL(bulk.commands, (count + 63U) / 64U)) return;
+    if (!TEST_ASSERT(!memcmp(back, buf, count * 512U))) { printf("  Read %u x%u\n", unsigned(block), count); return; }
+  }
+}
+
+// A full uint16_t count is split without overflowing the uint8_t block count of a command
+MARLIN_TEST(usb_flash, large_count) {
+  static uint8_t large[UINT16_MAX * 512U]; // Only addressed, never touched
+  uint32_t commands = 0, blocks = 0, next = 100;
+  const uint8_t *expect = large;
+  const bool ok = bulk_transfer_blocks(next, (const uint8_t *)large, UINT16_MAX, [&](const uint32_t b, const uint8_t * const s, const uint8_t n) {
+    commands++; blocks += n;
+    const bool in_order = (b == next && s == expect && n >= 1 && n <= USB_MAX_BLOCKS_PER_TRANSFER);
+    next += n; expect += n * 512U;
+    return in_order ? 0 : 1;
+  });
+  TEST_ASSERT(ok);
+  TEST_ASSERT_EQUAL(commands, (UINT16_MAX + 63U) / 64U);
+  TEST_ASSERT_EQUAL(blocks, uint32_t(UINT16_MAX));
+}
+
+// A failed command ends the transfer, and nothing after it is sent
+MARLIN_TEST(usb_flash, failed_command) {
+  bulk = BulkOnly_RAM();
+  bulk.fail_on = 1;
+  TEST_ASSERT(!usb_read(0, buf, 200));
+  TEST_ASSERT_EQUAL(bulk.commands, 2U);
+  TEST_ASSERT_EQUAL(bulk.blocks, 64U);
+
+  bulk = BulkOnly_RAM();
+  bulk.fail_on = 0;
+  TEST_ASSERT(!usb_write(10, buf, 3));
+  TEST_ASSERT_EQUAL(bulk.commands, 1U);
+  TEST_ASSERT_EQUAL(bulk.blocks, 0U);
+
+  bulk = BulkOnly_RAM();
+  TEST_ASSERT(usb_read(0, buf, RAM_BLOCKS));
+}
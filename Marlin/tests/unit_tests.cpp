@@ -0,0 +1,79 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * unit_tests.cpp - Runner for the host unit tests
+ *
+ * Usage: unit_tests [bench]
+ */
+
+#include "unit_tests.h"
+
+#include <time.h>
+
+namespace marlin_tests {
+
+  static Test *first = nullptr, **last = &first;
+  static uint32_t failures;
+
+  volatile float float_sink;
+  volatile uint32_t int_sink;
+
+  // Tests register themselves in the order they are defined
+  Test::Test(const char * const suite, const char * const name, const test_fn_t fn, const bool bench)
+    : suite(suite), name(name), fn(fn), bench(bench), next(nullptr) { *last = this; last = &next; }
+
+  bool check(const bool ok, const char * const file, const int line, const char * const expr) {
+    if (!ok) {
+      failures++;
+      printf("  %s:%d: Failed: %s\n", file, line, expr);
+    }
+    return ok;
+  }
+
+  uint64_t nanos() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return uint64_t(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+  }
+
+  void report(const char * const what, const uint64_t ns, const uint32_t ops) {
+    printf("  %-32s %8.2f ns\n", what, double(ns) / ops);
+  }
+
+}
+
+int main(const int argc, const char * const argv[]) {
+  using namespace marlin_tests;
+  const bool bench = argc > 1 && !strcmp(argv[1], "bench");
+  uint32_t tests = 0, failed = 0;
+  for (Test *t = first; t; t = t->next) {
+    if (t->bench && !bench) continue;
+    printf("%s %s.%s\n", t->bench ? "Bench" : "Test ", t->suite, t->name);
+    const uint32_t before = failures;
+    t->fn();
+    tests++;
+    if (failures != before) failed++;
+  }
+  printf("%u run, %u failed\n", tests, failed);
+  return failed ? 1 : 0;
+}
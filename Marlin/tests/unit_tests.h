@@ -0,0 +1,82 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * unit_tests.h - A minimal framework for the host unit tests
+ *
+ * The tests build with the host compiler and no Marlin configuration, so they
+ * only cover code that has no configuration dependencies.
+ *
+ *  MARLIN_TEST(SUITE, NAME) { ... }   Define a test
+ *  MARLIN_BENCH(SUITE, NAME) { ... }  Define a benchmark, run with 'run_unit_tests bench'
+ *
+ * Failed assertions are reported and counted, and the test carries on.
+ * Each assertion returns 'true' if it passed, so loops can stop early.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace marlin_tests {
+
+  typedef void (*test_fn_t)();
+
+  struct Test {
+    const char *suite, *name;
+    test_fn_t fn;
+    bool bench;
+    Test *next;
+    Test(const char * const suite, const char * const name, const test_fn_t fn, const bool bench);
+  };
+
+  bool check(const bool ok, const char * const file, const int line, const char * const expr);
+  uint64_t nanos();   // Monotonic time, for benchmarks
+
+  // Report a benchmark result per operation
+  void report(const char * const what, const uint64_t ns, const uint32_t ops);
+
+  // Keep the optimizer from dropping benchmarked work
+  extern volatile float float_sink;
+  extern volatile uint32_t int_sink;
+
+  // Small deterministic random source for fuzz tests
+  struct Random {
+    uint32_t state;
+    Random(const uint32_t seed=0x2545F491) : state(seed) {}
+    uint32_t next() { state ^= state << 13; state ^= state >> 17; state ^= state << 5; return state; }
+    uint32_t below(const uint32_t n) { return next() % n; }
+  };
+
+}
+
+#define _MARLIN_TEST(SUITE, NAME, BENCH) \
+  static void SUITE##_##NAME(); \
+  static marlin_tests::Test SUITE##_##NAME##_test(#SUITE, #NAME, SUITE##_##NAME, BENCH); \
+  static void SUITE##_##NAME()
+
+#define MARLIN_TEST(SUITE, NAME)  _MARLIN_TEST(SUITE, NAME, false)
+#define MARLIN_BENCH(SUITE, NAME) _MARLIN_TEST(SUITE, NAME, true)
+
+#define TEST_ASSERT(C)          marlin_tests::check(!!(C), __FILE__, __LINE__, #C)
+#define TEST_ASSERT_EQUAL(A, B) marlin_tests::check((A) == (B), __FILE__, __LINE__, #A " == " #B)
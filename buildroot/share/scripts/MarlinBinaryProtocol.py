@@ -438,6 +438,80 @@ class FileTransferProtocol(object):
         return True
 
 
+class MotionStreamProtocol(object):
+    protocol_id = 2
+
+    class Packet(object):
+        QUERY = 0
+        MOVE  = 1
+
+    FLAG_FEEDRATE = 1 << 14
+    FLAG_RELATIVE = 1 << 15
+
+    responses = deque()
+    def __init__(self, protocol, timeout = None):
+        protocol.register(['PMS:version:', 'PMS:invalid', 'PMS:stopped'], self.process_input)
+        self.protocol = protocol
+        self.response_timeout = timeout or protocol.response_timeout
+        self.scale = 1000
+        self.axes = 4
+        self.pending = bytearray()
+
+    def process_input(self, data):
+        self.responses.append(data)
+
+    def await_response(self, timeout = None):
+        timeout = TimeOut(timeout or self.response_timeout)
+        while not len(self.responses):
+            time.sleep(0.0001)
+            if timeout.timedout():
+                raise ReadTimeout()
+
+        return self.responses.popleft()
+
+    def connect(self):
+        self.protocol.send(MotionStreamProtocol.protocol_id, MotionStreamProtocol.Packet.QUERY);
+
+        token, data = self.await_response()
+        if token != 'PMS:version:':
+            return False
+
+        fields = data.split(':')
+        self.version = fields[0]
+        self.scale = int(fields[2])
+        self.axes = int(fields[4])
+        print("Motion Stream version: {0}, scale: {1}, axes: {2}".format(self.version, self.scale, self.axes))
+        return True
+
+    # Queue a move. 'axes' is a list of values (or None) in axis order, e.g. [x, y, z, e]
+    def move(self, axes, feedrate = None, relative = False):
+        flags = 0
+        payload = bytearray()
+        for i, value in enumerate(axes[:self.axes]):
+            if value is not None:
+                flags |= 1 << i
+                payload += int(round(value * self.scale)).to_bytes(4, byteorder='little', signed=True)
+        if feedrate is not None:
+            flags |= MotionStreamProtocol.FLAG_FEEDRATE
+            payload += int(round(feedrate * self.scale)).to_bytes(4, byteorder='little', signed=True)
+        if relative:
+            flags |= MotionStreamProtocol.FLAG_RELATIVE
+        record = flags.to_bytes(2, byteorder='little') + payload
+
+        if len(self.pending) + len(record) > self.protocol.block_size:
+            self.flush()
+        self.pending += record
+
+    # Send the queued moves. The 'ok' arrives once they are in the planner.
+    def flush(self):
+        if len(self.pending):
+            self.protocol.send(MotionStreamProtocol.protocol_id, MotionStreamProtocol.Packet.MOVE, self.pending);
+            self.pending = bytearray()
+            while len(self.responses):
+                token, data = self.responses.popleft()
+                print("Motion Stream: {0}".format(token))
+
+
 class EchoProtocol(object):
     def __init__(self, protocol):
         protocol.register(['echo:'], self.process_input)
@@ -0,0 +1,157 @@
+#!/usr/bin/env python
+#
+# windowed_sender.py
+# Stream a G-code file to Marlin keeping several lines in flight.
+#
+# Marlin must be built with ADVANCED_OK so each "ok" reports the free
+# command slots (B) and planner blocks (P) along with the line number (N)
+# it acknowledges. The sender keeps no more lines unacknowledged than the
+# firmware has free slots, and reports the line rate and how often the
+# planner was full, i.e. the firmware had all the moves it could buffer.
+#
+# Usage: windowed_sender.py <port> <file.gcode> [-b BAUD] [-w MAX_WINDOW]
+#
+
+from __future__ import print_function
+
+import argparse
+import re
+import time
+from collections import deque
+
+import serial
+
+ok_re = re.compile(r'^ok(?: N(-?\d+))?(?: P(\d+))?(?: B(\d+))?')
+resend_re = re.compile(r'^Resend:\s*N?(\d+)', re.IGNORECASE)
+
+def checksum(line):
+    cs = 0
+    for c in line.encode('ascii', 'replace'):
+        cs ^= c
+    return cs
+
+def load_lines(path):
+    lines = []
+    with open(path, 'r') as f:
+        for raw in f:
+            line = raw.split(';', 1)[0].strip()
+            if line:
+                lines.append(line)
+    return lines
+
+class WindowedSender(object):
+    def __init__(self, port, baud, max_window):
+        self.ser = serial.Serial(port, baud, timeout=0.05)
+        self.max_window = max_window
+        self.window = 1             # Grows to the free slots reported by the firmware
+        self.in_flight = deque()    # Line numbers sent but not yet acknowledged
+        self.sent = {}              # Line number -> framed line, for resends
+        self.next_n = 1
+        self.rx = b''
+        self.planner_full = 0       # Acknowledgements that reported no free planner blocks
+        self.planner_reports = 0    # Acknowledgements that reported the planner at all
+        self.stale_resends = 0      # Resend requests still due for lines already dropped
+        self.min_free = None
+
+    def frame(self, n, line):
+        body = 'N%d %s' % (n, line)
+        return '%s*%d\n' % (body, checksum(body))
+
+    def write_line(self, n):
+        self.ser.write(self.sent[n].encode('ascii', 'replace'))
+        self.in_flight.append(n)
+
+    def read_lines(self):
+        self.rx += self.ser.read(self.ser.in_waiting or 1)
+        while b'\n' in self.rx:
+            raw, self.rx = self.rx.split(b'\n', 1)
+            yield raw.decode('ascii', 'replace').strip()
+
+    def handle(self, line):
+        m = ok_re.match(line)
+        if m:
+            # Only a numbered "ok" acknowledges a line. The "ok" that follows
+            # a resend request or an error carries no line number.
+            if m.group(1) is None:
+                return
+            n = int(m.group(1))
+            while self.in_flight and self.in_flight[0] <= n:
+                self.in_flight.popleft()
+            if m.group(2) is not None:
+                self.planner_reports += 1
+                if int(m.group(2)) == 0:
+                    self.planner_full += 1
+            if m.group(3) is not None:
+                free = int(m.group(3))
+                self.min_free = free if self.min_free is None else min(self.min_free, free)
+                # Free slots plus the lines still in flight is what may be outstanding
+                self.window = max(1, min(self.max_window, free + len(self.in_flight)))
+            return
+        m = resend_re.match(line)
+        if m:
+            # Every line sent after the bad one is rejected with its own
+            # resend request. Act on the first one only.
+            if self.stale_resends:
+                self.stale_resends -= 1
+                return
+            # Lines before the requested one were received and will still be
+            # acknowledged. Drop the rest and send them again.
+            n = int(m.group(1))
+            dropped = 0
+            while self.in_flight and self.in_flight[-1] >= n:
+                self.in_flight.pop()
+                dropped += 1
+            self.stale_resends = max(0, dropped - 1)
+            self.next_n = min(self.next_n, n)
+            return
+        if line.startswith('Error') or line.startswith('echo'):
+            print(line)
+
+    def reset_line_numbers(self):
+        self.ser.write(b'M110 N0\n')
+        deadline = time.time() + 5
+        while time.time() < deadline:
+            for line in self.read_lines():
+                if line.startswith('ok'):
+                    return
+        raise IOError('No response to M110')
+
+    def stream(self, lines):
+        self.reset_line_numbers()
+        total = len(lines)
+        start = time.time()
+        last_report = start
+        while self.next_n <= total or self.in_flight:
+            while self.next_n <= total and len(self.in_flight) < self.window:
+                n = self.next_n
+                if n not in self.sent:
+                    self.sent[n] = self.frame(n, lines[n - 1])
+                self.write_line(n)
+                self.next_n += 1
+
+            for line in self.read_lines():
+                self.handle(line)
+
+            now = time.time()
+            if now - last_report >= 1:
+                last_report = now
+                done = self.next_n - 1 - len(self.in_flight)
+                print('\r%d/%d lines, %.0f lines/s, window %d' % (done, total, done / (now - start), self.window), end='')
+
+        elapsed = time.time() - start
+        full = 100.0 * self.planner_full / self.planner_reports if self.planner_reports else 0
+        print('\r%d lines in %.1fs: %.0f lines/s, lowest free slots %s, planner full at %.0f%% of acknowledgements' % (total, elapsed, total / elapsed, self.min_free, full))
+
+def main():
+    parser = argparse.ArgumentParser(description='Stream G-code to Marlin using ADVANCED_OK flow control.')
+    parser.add_argument('port', help='Serial port, e.g. /dev/ttyACM0')
+    parser.add_argument('file', help='G-code file to send')
+    parser.add_argument('-b', '--baud', type=int, default=250000, help='Baud rate (default 250000)')
+    parser.add_argument('-w', '--window', type=int, default=64, help='Most lines to keep in flight (default 64)')
+    args = parser.parse_args()
+
+    sender = WindowedSender(args.port, args.baud, args.window)
+    sender.stream(load_lines(args.file))
+
+if __name__ == '__main__':
+    main()